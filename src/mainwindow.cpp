@@ -293,6 +293,7 @@ void MainWindow::aggregationUpdate()
 {
     static_cast<SearchResultModel*>(ui->searchResultView->model())->updateData({});
     mAggregationStatusLabel->setText(mAggregationDialog->viewConfig()->currentAggregation().typeText());
+    ui->modelInspector->updateAggregation();
 }
 
 void MainWindow::viewConfigUpdate()
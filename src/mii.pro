@@ -88,8 +88,7 @@ SOURCES += \
     mii/filtertreeitem.cpp \
     mii/filtertreemodel.cpp \
     mii/hierarchicalheaderview.cpp \
-    mii/identifierfiltermodel.cpp \
-    mii/labelfiltermodel.cpp \
+    mii/labelfiltertree.cpp \
     mii/labelfilterwidget.cpp \
     mii/labeltreeitem.cpp \
     mii/modelinstance.cpp    \
@@ -99,6 +98,7 @@ SOURCES += \
     mii/postopttreemodel.cpp \
     mii/postopttreeview.cpp \
     mii/postopttreeviewframe.cpp \
+    mii/reduction.cpp \
     mii/search.cpp \
     mii/searchresultmodel.cpp \
     mii/sectiontreeitem.cpp \
@@ -106,6 +106,7 @@ SOURCES += \
     mii/sectiontreeview.cpp \
     mii/standardtableviewframe.cpp \
     mii/symbol.cpp \
+    mii/symbolfiltermodel.cpp \
     mii/symbolmodelinstancetablemodel.cpp \
     mii/symbolviewframe.cpp \
     mii/valueformatproxymodel.cpp \
@@ -125,6 +126,7 @@ HEADERS += \
     mii/abstractviewframe.h \
     mii/aggregation.h \
     mii/aggregationdialog.h \
+    mii/attributecache.h \
     mii/bpidentifierfiltermodel.h \
     mii/bpviewframe.h \
     mii/columnrowfiltermodel.h \
@@ -132,21 +134,25 @@ HEADERS += \
     mii/comprehensivetablemodel.h \
     mii/datahandler.h \
     mii/datamatrix.h \
+    mii/densematrix.h \
     mii/filterdialog.h \
     mii/filtertreeitem.h \
     mii/filtertreemodel.h \
+    mii/headerspan.h \
     mii/hierarchicalheaderview.h \
-    mii/identifierfiltermodel.h \
-    mii/labelfiltermodel.h \
+    mii/labelfiltertree.h \
     mii/labelfilterwidget.h \
+    mii/labelsectionindex.h \
     mii/labeltreeitem.h \
     mii/modelinstance.h  \
     mii/modelinspector.h \
+    mii/nlflags.h \
     mii/modelinstancetableview.h \
     mii/postopttreeitem.h \
     mii/postopttreemodel.h \
     mii/postopttreeview.h \
     mii/postopttreeviewframe.h \
+    mii/reduction.h \
     mii/search.h \
     mii/searchresultmodel.h \
     mii/sectiontreeitem.h \
@@ -154,6 +160,7 @@ HEADERS += \
     mii/sectiontreeview.h \
     mii/standardtableviewframe.h \
     mii/symbol.h \
+    mii/symbolfiltermodel.h \
     mii/symbolmodelinstancetablemodel.h \
     mii/symbolviewframe.h \
     mii/valueformatproxymodel.h \
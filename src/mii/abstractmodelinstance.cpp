@@ -153,6 +153,18 @@ const QStringList &AbstractModelInstance::labels() const
     return mLabels;
 }
 
+const LabelSectionIndex &AbstractModelInstance::labelSections(Qt::Orientation orientation)
+{
+    if (orientation == Qt::Horizontal) {
+        if (mVariableLabelSections.isEmpty())
+            mVariableLabelSections.build(variables(), mLabels.size());
+        return mVariableLabelSections;
+    }
+    if (mEquationLabelSections.isEmpty())
+        mEquationLabelSections.build(equations(), mLabels.size());
+    return mEquationLabelSections;
+}
+
 int AbstractModelInstance::nlFlag(int row, int column, int viewId)
 {
     Q_UNUSED(row);
@@ -161,12 +173,30 @@ int AbstractModelInstance::nlFlag(int row, int column, int viewId)
     return 0;
 }
 
+QList<int> AbstractModelInstance::logicalIndices(int section,
+                                                Qt::Orientation orientation,
+                                                int view) const
+{
+    Q_UNUSED(section);
+    Q_UNUSED(orientation);
+    Q_UNUSED(view);
+    return QList<int>();
+}
+
 QVariant AbstractModelInstance::equationAttribute(const QString &header,
                                                   int index,
                                                   int entry,
                                                   bool abs) const
 {
-    Q_UNUSED(header);
+    return equationAttribute(AttributeHelper::attributeType(header), index, entry, abs);
+}
+
+QVariant AbstractModelInstance::equationAttribute(AttributeHelper::AttributeType type,
+                                                  int index,
+                                                  int entry,
+                                                  bool abs) const
+{
+    Q_UNUSED(type);
     Q_UNUSED(index);
     Q_UNUSED(entry);
     Q_UNUSED(abs);
@@ -178,7 +208,15 @@ QVariant AbstractModelInstance::variableAttribute(const QString &header,
                                                   int entry,
                                                   bool abs) const
 {
-    Q_UNUSED(header);
+    return variableAttribute(AttributeHelper::attributeType(header), index, entry, abs);
+}
+
+QVariant AbstractModelInstance::variableAttribute(AttributeHelper::AttributeType type,
+                                                  int index,
+                                                  int entry,
+                                                  bool abs) const
+{
+    Q_UNUSED(type);
     Q_UNUSED(index);
     Q_UNUSED(entry);
     Q_UNUSED(abs);
@@ -230,6 +268,11 @@ double EmptyModelInstance::rhs(int row) const
     return 0.0;
 }
 
+void EmptyModelInstance::equationRhs(double *values)
+{
+    Q_UNUSED(values);
+}
+
 QString EmptyModelInstance::longestEquationText() const
 {
     return QString();
@@ -333,6 +376,12 @@ void EmptyModelInstance::loadViewData(QSharedPointer<AbstractViewConfiguration>
     Q_UNUSED(viewConfig);
 }
 
+bool EmptyModelInstance::updateViewData(QSharedPointer<AbstractViewConfiguration> viewConfig)
+{
+    Q_UNUSED(viewConfig);
+    return false;
+}
+
 QVariant EmptyModelInstance::data(int row, int column, int view) const
 {
     Q_UNUSED(row);
@@ -341,6 +390,14 @@ QVariant EmptyModelInstance::data(int row, int column, int view) const
     return QVariant();
 }
 
+NumericValue EmptyModelInstance::numericData(int row, int column, int view) const
+{
+    Q_UNUSED(row);
+    Q_UNUSED(column);
+    Q_UNUSED(view);
+    return NumericValue();
+}
+
 QSharedPointer<PostoptTreeItem> EmptyModelInstance::dataTree(int view) const
 {
     Q_UNUSED(view);
@@ -21,6 +21,7 @@
 #ifndef ABSTRACTMODELINSTANCE_H
 #define ABSTRACTMODELINSTANCE_H
 
+#include "labelsectionindex.h"
 #include "symbol.h"
 
 #include <QString>
@@ -35,7 +36,13 @@ class AbstractViewConfiguration;
 class DataMatrix;
 class PostoptTreeItem;
 
-class AbstractModelInstance
+///
+/// \brief Base of the model instances, which are owned by QSharedPointer.
+/// \remark Items created on demand, e.g. the postopt tree, keep a weak
+///         reference via sharedFromThis(), which avoids dangling symbols
+///         when the instance is replaced.
+///
+class AbstractModelInstance : public QEnableSharedFromThis<AbstractModelInstance>
 {
 protected:
     AbstractModelInstance(const QString &workspace,
@@ -150,8 +157,20 @@ public:
 
     virtual double rhs(int row) const = 0;
 
+    ///
+    /// \brief Copies the right-hand sides of all equation rows to
+    ///        <c>values</c>, which has to have equationRowCount() entries.
+    ///
+    virtual void equationRhs(double *values) = 0;
+
     const QStringList& labels() const;
 
+    ///
+    /// \brief Inverted label index of the equations (Qt::Vertical) or
+    ///        variables (Qt::Horizontal), which is built on first use.
+    ///
+    const LabelSectionIndex& labelSections(Qt::Orientation orientation);
+
     virtual QString longestEquationText() const = 0;
 
     virtual QString longestVariableText() const = 0;
@@ -180,8 +199,17 @@ public:
 
     virtual void loadViewData(QSharedPointer<AbstractViewConfiguration> viewConfig) = 0;
 
+    ///
+    /// \brief Updates the view data after a value filter change, where the
+    ///        data is only loaded again if the visible symbols changed.
+    /// \return <c>true</c> if the data was loaded again.
+    ///
+    virtual bool updateViewData(QSharedPointer<AbstractViewConfiguration> viewConfig) = 0;
+
     virtual QVariant data(int row, int column, int view) const = 0;
 
+    virtual NumericValue numericData(int row, int column, int view) const = 0;
+
     virtual int nlFlag(int row, int column, int viewId);
 
     virtual QSharedPointer<PostoptTreeItem> dataTree(int view) const = 0;
@@ -194,11 +222,23 @@ public:
                                 Qt::Orientation orientation,
                                 int view, int role) const = 0;
 
+    ///
+    /// \brief Logical indices of <c>view</c> whose IndexDataRole header is
+    ///        the Jacobian <c>section</c>.
+    ///
+    virtual QList<int> logicalIndices(int section,
+                                      Qt::Orientation orientation,
+                                      int view) const;
+
     virtual DataMatrix* jacobianData() = 0;
 
-    virtual QVariant equationAttribute(const QString &header, int index, int entry, bool abs) const;
+    QVariant equationAttribute(const QString &header, int index, int entry, bool abs) const;
+
+    virtual QVariant equationAttribute(AttributeHelper::AttributeType type, int index, int entry, bool abs) const;
 
-    virtual QVariant variableAttribute(const QString &header, int index, int entry, bool abs) const;
+    QVariant variableAttribute(const QString &header, int index, int entry, bool abs) const;
+
+    virtual QVariant variableAttribute(AttributeHelper::AttributeType type, int index, int entry, bool abs) const;
 
     virtual int maxSymbolDimension(int viewId, Qt::Orientation orientation) const = 0;
 
@@ -222,6 +262,10 @@ protected:
     QStringList mLogMessages;
 
     QStringList mLabels;
+
+private:
+    LabelSectionIndex mEquationLabelSections;
+    LabelSectionIndex mVariableLabelSections;
 };
 
 class EmptyModelInstance final : public AbstractModelInstance
@@ -243,6 +287,8 @@ public:
 
     double rhs(int row) const override;
 
+    void equationRhs(double *values) override;
+
     QString longestEquationText() const override;
 
     QString longestVariableText() const override;
@@ -279,8 +325,12 @@ public:
 
     void loadViewData(QSharedPointer<AbstractViewConfiguration> viewConfig) override;
 
+    bool updateViewData(QSharedPointer<AbstractViewConfiguration> viewConfig) override;
+
     QVariant data(int row, int column, int view) const override;
 
+    NumericValue numericData(int row, int column, int view) const override;
+
     QSharedPointer<PostoptTreeItem> dataTree(int view) const override;
 
     QVariant headerData(int logicalIndex,
@@ -22,6 +22,9 @@
 #include "common.h"
 
 #include <QEvent>
+#include <QHeaderView>
+#include <QScrollBar>
+#include <QStyle>
 #include <QWheelEvent>
 
 namespace gams {
@@ -31,7 +34,10 @@ namespace mii {
 AbstractTableView::AbstractTableView(QWidget *parent)
     : QTableView(parent)
 {
-
+    connect(horizontalScrollBar(), &QScrollBar::valueChanged,
+            this, &AbstractTableView::refineVisibleCells);
+    connect(verticalScrollBar(), &QScrollBar::valueChanged,
+            this, &AbstractTableView::refineVisibleCells);
 }
 
 bool AbstractTableView::eventFilter(QObject *watched, QEvent *event)
@@ -52,22 +58,52 @@ bool AbstractTableView::eventFilter(QObject *watched, QEvent *event)
 void AbstractTableView::zoomIn(int range)
 {
     zoom(range);
-    resizeColumnsToContents();
-    resizeRowsToContents();
 }
 
 void AbstractTableView::zoomOut(int range)
 {
     zoom(-range);
-    resizeColumnsToContents();
-    resizeRowsToContents();
 }
 
 void AbstractTableView::resetZoom()
 {
     setFont(mBaseFont);
-    resizeColumnsToContents();
-    resizeRowsToContents();
+    resizeToSample();
+}
+
+void AbstractTableView::resizeToSample()
+{
+    mSampledColumns.clear();
+    mSampledRows.clear();
+    mSampledFirstColumn = mSampledLastColumn = -1;
+    if (!model() || !model()->rowCount() || !model()->columnCount())
+        return;
+    mSampledColumns.resize(model()->columnCount());
+    mSampledRows.resize(model()->rowCount());
+
+    int firstRow, lastRow;
+    if (visibleRange(Qt::Vertical, firstRow, lastRow)) {
+        int rowHeight = 0;
+        for (int r=firstRow; r<=lastRow; ++r) {
+            rowHeight = qMax(rowHeight, sizeHintForRow(r));
+            if (!verticalHeader()->isHidden())
+                rowHeight = qMax(rowHeight, verticalHeader()->sectionSizeHint(r));
+        }
+        if (rowHeight > 0)
+            verticalHeader()->setDefaultSectionSize(rowHeight);
+    }
+
+    QFontMetrics metrics(font());
+    auto rows = sampleRows();
+    int columns = model()->columnCount();
+    int step = qMax(1, columns / SampleSize);
+    int estimate = 0;
+    for (int c=0; c<columns; c+=step) {
+        estimate = qMax(estimate, sampleColumnWidth(c, rows, metrics));
+    }
+    if (estimate > 0)
+        horizontalHeader()->setDefaultSectionSize(estimate);
+    refineVisibleCells();
 }
 
 void AbstractTableView::zoom(int range)
@@ -80,8 +116,103 @@ void AbstractTableView::zoom(int range)
         return;
     f.setPointSize(newSize);
     setFont(f);
-    resizeColumnsToContents();
-    resizeRowsToContents();
+    resizeToSample();
+}
+
+void AbstractTableView::refineVisibleCells()
+{
+    if (!model() || mSampledColumns.isEmpty())
+        return;
+    if (mSampledColumns.size() != model()->columnCount())
+        mSampledColumns.resize(model()->columnCount());
+    if (mSampledRows.size() != model()->rowCount())
+        mSampledRows.resize(model()->rowCount());
+    int firstColumn, lastColumn, firstRow, lastRow;
+    if (!visibleRange(Qt::Horizontal, firstColumn, lastColumn) ||
+            !visibleRange(Qt::Vertical, firstRow, lastRow))
+        return;
+    if (firstColumn != mSampledFirstColumn || lastColumn != mSampledLastColumn) {
+        mSampledRows.fill(false);
+        mSampledFirstColumn = firstColumn;
+        mSampledLastColumn = lastColumn;
+    }
+
+    QVector<int> newRows;
+    for (int r=firstRow; r<=lastRow; ++r) {
+        if (mSampledRows.testBit(r))
+            continue;
+        mSampledRows.setBit(r);
+        newRows.push_back(r);
+    }
+
+    QFontMetrics metrics(font());
+    QVector<int> rows;
+    for (int c=firstColumn; c<=lastColumn; ++c) {
+        int width;
+        if (!mSampledColumns.testBit(c)) {
+            if (rows.isEmpty())
+                rows = sampleRows();
+            width = sampleColumnWidth(c, rows, metrics);
+            mSampledColumns.setBit(c);
+        } else if (!newRows.isEmpty()) {
+            width = sampleColumnWidth(c, newRows, metrics);
+        } else {
+            continue;
+        }
+        if (width > columnWidth(c))
+            setColumnWidth(c, width);
+    }
+}
+
+int AbstractTableView::sampleColumnWidth(int column, const QVector<int> &rows,
+                                         const QFontMetrics &metrics) const
+{
+    int margin = 2 * (style()->pixelMetric(QStyle::PM_FocusFrameHMargin, nullptr, this) + 1);
+    int width = horizontalHeader()->isHidden() ? 0 : horizontalHeader()->sectionSizeHint(column);
+    for (int row : rows) {
+        auto text = model()->index(row, column).data(Qt::DisplayRole).toString();
+        if (!text.isEmpty())
+            width = qMax(width, metrics.horizontalAdvance(text) + margin);
+    }
+    return width;
+}
+
+QVector<int> AbstractTableView::sampleRows() const
+{
+    QVector<int> rows;
+    int firstRow, lastRow;
+    if (visibleRange(Qt::Vertical, firstRow, lastRow)) {
+        for (int r=firstRow; r<=lastRow; ++r)
+            rows.push_back(r);
+    }
+    int rowCount = model()->rowCount();
+    int step = qMax(1, rowCount / SampleSize);
+    for (int r=0; r<rowCount; r+=step) {
+        if (r < firstRow || r > lastRow)
+            rows.push_back(r);
+    }
+    return rows;
+}
+
+bool AbstractTableView::visibleRange(Qt::Orientation orientation, int &first, int &last) const
+{
+    first = last = -1;
+    if (!model())
+        return false;
+    if (!viewport()->width() || !viewport()->height())
+        return false;
+    if (orientation == Qt::Horizontal) {
+        first = columnAt(0);
+        last = columnAt(viewport()->width()-1);
+        if (last < 0)
+            last = model()->columnCount()-1;
+    } else {
+        first = rowAt(0);
+        last = rowAt(viewport()->height()-1);
+        if (last < 0)
+            last = model()->rowCount()-1;
+    }
+    return first >= 0 && first <= last;
 }
 
 }
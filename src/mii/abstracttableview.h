@@ -21,6 +21,7 @@
 #ifndef ABSTRACTTABLEVIEW_H
 #define ABSTRACTTABLEVIEW_H
 
+#include <QBitArray>
 #include <QTableView>
 
 namespace gams {
@@ -40,11 +41,52 @@ public:
     void zoomOut(int range = 1);
     void resetZoom();
 
+    ///
+    /// \brief Sizes the rows and columns from a bounded sample of cells,
+    ///        instead of measuring every cell like
+    ///        <c>resizeColumnsToContents()</c>.
+    /// \remark The visible columns and a strided sample of columns are
+    ///         measured, where all other columns get the widest sampled
+    ///         width. Each column is measured once when it is scrolled into
+    ///         view, and again for rows scrolled into view, where the
+    ///         width only grows.
+    ///
+    void resizeToSample();
+
 private:
     void zoom(int range);
 
+    ///
+    /// \brief Measures the visible columns which are not sampled yet and
+    ///        the visible rows which are not sampled yet for the visible
+    ///        columns.
+    /// \remark The sampled rows refer to the visible column range and are
+    ///         reset when it changes.
+    ///
+    void refineVisibleCells();
+
+    ///
+    /// \brief Width of <c>column</c> as the widest formatted cell of
+    ///        <c>rows</c> and the header section.
+    ///
+    int sampleColumnWidth(int column, const QVector<int> &rows,
+                          const QFontMetrics &metrics) const;
+
+    ///
+    /// \brief Visible rows plus a strided sample of all rows.
+    ///
+    QVector<int> sampleRows() const;
+
+    bool visibleRange(Qt::Orientation orientation, int &first, int &last) const;
+
 private:
+    static const int SampleSize = 64;
+
     QFont mBaseFont;
+    QBitArray mSampledColumns;
+    QBitArray mSampledRows;
+    int mSampledFirstColumn = -1;
+    int mSampledLastColumn = -1;
 };
 
 }
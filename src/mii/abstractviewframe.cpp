@@ -39,13 +39,16 @@ AbstractViewFrame::~AbstractViewFrame()
 
 void AbstractViewFrame::updateFilters(AbstractViewConfiguration::Options options)
 {
-    if (options | AbstractViewConfiguration::IdentifierConfig) {
+    if (options & AbstractViewConfiguration::AggregationConfig) {
+        updateAggregation();
+    }
+    if (options & AbstractViewConfiguration::IdentifierConfig) {
         updateIdentifierFilter();
     }
-    if (options | AbstractViewConfiguration::LabelConfig) {
+    if (options & AbstractViewConfiguration::LabelConfig) {
         updateLabelFilter();
     }
-    if (options | AbstractViewConfiguration::ValueConfig) {
+    if (options & AbstractViewConfiguration::ValueConfig) {
         updateValueFilter();
     }
 }
@@ -65,6 +68,11 @@ void AbstractViewFrame::setViewConfig(const QSharedPointer<AbstractViewConfigura
     mViewConfig = viewConfig;
 }
 
+void AbstractViewFrame::updateAggregation()
+{
+
+}
+
 void AbstractViewFrame::updateIdentifierFilter()
 {
 
@@ -77,6 +77,8 @@ public:
     virtual bool hasData() const = 0;
 
 protected:
+    virtual void updateAggregation();
+
     virtual void updateIdentifierFilter();
 
     virtual void updateLabelFilter();
@@ -264,6 +264,18 @@ bool Aggregation::isActive() const
             !mAggregationMap[Qt::Vertical].isEmpty();
 }
 
+double Aggregation::median(double *values, int count)
+{
+    if (count <= 0)
+        return 0.0;
+    auto middle = values + count/2;
+    std::nth_element(values, middle, values+count);
+    if (count % 2)
+        return *middle;
+    // the lower middle is the maximum of the lower half after the selection
+    return (*std::max_element(values, middle) + *middle) / 2.0;
+}
+
 Aggregator::Aggregator(const Symbol *symbol)
     : mSymbol(symbol)
 {
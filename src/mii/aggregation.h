@@ -174,6 +174,13 @@ public:
 
     bool isActive() const;
 
+    ///
+    /// \brief Median of <c>count</c> values.
+    /// \remark The values are reordered, because the median is selected
+    ///         instead of sorting all values.
+    ///
+    static double median(double *values, int count);
+
 private:
     bool mUseAbsoluteValues = false;
     Type mType = None;
@@ -0,0 +1,123 @@
+/**
+ * GAMS Model Instance Inspector (MII)
+ *
+ * Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef ATTRIBUTECACHE_H
+#define ATTRIBUTECACHE_H
+
+#include <QVector>
+
+#include "common.h"
+
+namespace gams {
+namespace studio {
+namespace mii {
+
+///
+/// \brief Attribute vectors of all equation and variable rows, which are
+///        loaded once and addressed by the attribute type.
+/// \remark Only the stored attributes are cached, i.e. level, marginal,
+///         lower bound, upper bound and scale. The derived attributes,
+///         like the slacks, are computed from these.
+///
+class AttributeCache
+{
+public:
+    AttributeCache() = default;
+
+    static bool isCached(AttributeHelper::AttributeType type)
+    {
+        return slot(type) >= 0;
+    }
+
+    ///
+    /// \brief Resizes the vectors, where all values are set to 0.
+    ///
+    void resize(int equationRows, int variableRows)
+    {
+        for (int s=0; s<Slots; ++s) {
+            mEquations[s].fill(0.0, equationRows);
+            mVariables[s].fill(0.0, variableRows);
+        }
+    }
+
+    ///
+    /// \brief Number of rows of <c>orientation</c>, where Qt::Vertical
+    ///        addresses the equations and Qt::Horizontal the variables.
+    ///
+    int size(Qt::Orientation orientation) const
+    {
+        return orientation == Qt::Vertical ? mEquations[0].size() : mVariables[0].size();
+    }
+
+    ///
+    /// \brief Vector of <c>type</c> to load the values or <c>nullptr</c> if
+    ///        <c>type</c> is not cached.
+    ///
+    double* data(AttributeHelper::AttributeType type, Qt::Orientation orientation)
+    {
+        int s = slot(type);
+        if (s < 0)
+            return nullptr;
+        return orientation == Qt::Vertical ? mEquations[s].data() : mVariables[s].data();
+    }
+
+    ///
+    /// \brief Value of <c>type</c> in row <c>section</c> or 0.0 if
+    ///        <c>type</c> is not cached.
+    ///
+    double value(AttributeHelper::AttributeType type, Qt::Orientation orientation, int section) const
+    {
+        int s = slot(type);
+        if (s < 0)
+            return 0.0;
+        return orientation == Qt::Vertical ? mEquations[s].value(section) : mVariables[s].value(section);
+    }
+
+private:
+    static int slot(AttributeHelper::AttributeType type)
+    {
+        switch (type) {
+        case AttributeHelper::Level:
+            return 0;
+        case AttributeHelper::Marginal:
+        case AttributeHelper::MarginalNum:
+            return 1;
+        case AttributeHelper::Lower:
+            return 2;
+        case AttributeHelper::Upper:
+            return 3;
+        case AttributeHelper::Scale:
+            return 4;
+        default:
+            return -1;
+        }
+    }
+
+private:
+    static const int Slots = 5;
+    QVector<double> mEquations[Slots];
+    QVector<double> mVariables[Slots];
+};
+
+}
+}
+}
+
+#endif // ATTRIBUTECACHE_H
@@ -183,14 +183,13 @@ void BPOverviewViewFrame::setShowAbsoluteValues(bool absoluteValues)
     Q_UNUSED(absoluteValues);
     if (!mBaseModel)
         return;
-    mModelInstance->loadViewData(mViewConfig);
+    mModelInstance->updateViewData(mViewConfig);
     emit mBaseModel->dataChanged(QModelIndex(), QModelIndex(), {Qt::DisplayRole});
 }
 
 void BPOverviewViewFrame::updateView()
 {
-    ui->tableView->resizeColumnsToContents();
-    ui->tableView->resizeRowsToContents();
+    ui->tableView->resizeToSample();
     emit filtersChanged();
 }
 
@@ -210,8 +209,7 @@ void BPOverviewViewFrame::setupView()
     ui->tableView->horizontalHeader()->setVisible(true);
     mBaseModel = QSharedPointer<BPOverviewTableModel>(baseModel);
 
-    ui->tableView->resizeColumnsToContents();
-    ui->tableView->resizeRowsToContents();
+    ui->tableView->resizeToSample();
 }
 
 BPCountViewFrame::BPCountViewFrame(QWidget *parent, Qt::WindowFlags f)
@@ -259,8 +257,7 @@ void BPCountViewFrame::setShowAbsoluteValues(bool absoluteValues)
 
 void BPCountViewFrame::updateView()
 {
-    ui->tableView->resizeColumnsToContents();
-    ui->tableView->resizeRowsToContents();
+    ui->tableView->resizeToSample();
     emit filtersChanged();
 }
 
@@ -296,8 +293,7 @@ void BPCountViewFrame::setupView()
     ui->tableView->horizontalHeader()->setVisible(true);
     mBaseModel = QSharedPointer<ComprehensiveTableModel>(baseModel);
 
-    ui->tableView->resizeColumnsToContents();
-    ui->tableView->resizeRowsToContents();
+    ui->tableView->resizeToSample();
 }
 
 BPAverageViewFrame::BPAverageViewFrame(QWidget *parent, Qt::WindowFlags f)
@@ -346,8 +342,7 @@ void BPAverageViewFrame::setShowAbsoluteValues(bool absoluteValues)
 
 void BPAverageViewFrame::updateView()
 {
-    ui->tableView->resizeColumnsToContents();
-    ui->tableView->resizeRowsToContents();
+    ui->tableView->resizeToSample();
     emit filtersChanged();
 }
 
@@ -383,8 +378,7 @@ void BPAverageViewFrame::setupView()
     ui->tableView->horizontalHeader()->setVisible(true);
     mBaseModel = QSharedPointer<ComprehensiveTableModel>(baseModel);
 
-    ui->tableView->resizeColumnsToContents();
-    ui->tableView->resizeRowsToContents();
+    ui->tableView->resizeToSample();
 }
 
 BPScalingViewFrame::BPScalingViewFrame(QWidget *parent, Qt::WindowFlags f)
@@ -421,7 +415,7 @@ void BPScalingViewFrame::setShowAbsoluteValues(bool absoluteValues)
     Q_UNUSED(absoluteValues);
     if (!mBaseModel || !mValueFormatModel)
         return;
-    mModelInstance->loadViewData(mViewConfig);
+    mModelInstance->updateViewData(mViewConfig);
     emit mBaseModel->dataChanged(QModelIndex(), QModelIndex(), {Qt::DisplayRole});
     mValueFormatModel->setValueFilter(mViewConfig->currentValueFilter());
 }
@@ -438,8 +432,7 @@ void BPScalingViewFrame::setupView(const QSharedPointer<AbstractModelInstance> &
 
 void BPScalingViewFrame::updateView()
 {
-    ui->tableView->resizeColumnsToContents();
-    ui->tableView->resizeRowsToContents();
+    ui->tableView->resizeToSample();
     emit filtersChanged();
 }
 
@@ -447,7 +440,7 @@ void BPScalingViewFrame::updateValueFilter()
 {
     if (!mBaseModel)
         return;
-    mModelInstance->loadViewData(mViewConfig);
+    mModelInstance->updateViewData(mViewConfig);
     emit mBaseModel->dataChanged(QModelIndex(), QModelIndex(), {Qt::DisplayRole});
     mValueFormatModel->setValueFilter(mViewConfig->currentValueFilter());
 }
@@ -478,8 +471,7 @@ void BPScalingViewFrame::setupView()
     ui->tableView->verticalHeader()->setVisible(true);
     mBaseModel = QSharedPointer<ComprehensiveTableModel>(baseModel);
 
-    ui->tableView->resizeColumnsToContents();
-    ui->tableView->resizeRowsToContents();
+    ui->tableView->resizeToSample();
 }
 
 }
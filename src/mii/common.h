@@ -21,6 +21,7 @@
 #ifndef COMMON_H
 #define COMMON_H
 
+#include <cmath>
 #include <limits>
 
 #include <QMap>
@@ -51,7 +52,9 @@ public:
         SlackUB,
         Slack,
         Infeasibility,
-        Type
+        Type,
+        /// Unknown attribute text.
+        Undefined
     };
 
     static QString attributeText(AttributeType type)
@@ -79,9 +82,43 @@ public:
             return SlackText;
         case Infeasibility:
             return InfeasibilityText;
-        default:
+        case Type:
             return TypeText;
+        default:
+            return QString();
+        }
+    }
+
+    ///
+    /// \brief Attribute of <c>text</c>, which is compared case insensitive.
+    ///
+    static AttributeType attributeType(const QString &text)
+    {
+        for (int type=Level; type<Undefined; ++type) {
+            if (!text.compare(attributeText(AttributeType(type)), Qt::CaseInsensitive))
+                return AttributeType(type);
         }
+        return Undefined;
+    }
+
+    ///
+    /// \brief The attributes of attributeTextList().
+    ///
+    static QVector<AttributeType> attributeTypeList()
+    {
+        return QVector<AttributeType> {
+            Level,
+            Marginal,
+            Lower,
+            Upper,
+            Scale,
+            Range,
+            SlackLB,
+            SlackUB,
+            Slack,
+            Infeasibility,
+            Type
+        };
     }
 
     static QVector<QString> attributeTextList()
@@ -162,12 +199,15 @@ public:
         EPS,
         INF,
         P_INF,
-        N_INF
+        N_INF,
+        NONE
     };
 
     static QString specialValueText(SpecialValueType type)
     {
         switch (type) {
+        case SpecialValueType::NONE:
+            return QString();
         case SpecialValueType::EPS:
             return EPSText;
         case SpecialValueType::INF:
@@ -203,6 +243,80 @@ public:
     static const QString PlusMinus;
 };
 
+///
+/// \brief Raw cell value with its special value tag, which is provided by the
+///        ViewHelper::NumericDataRole. This allows the filter and format
+///        proxies to work on the double instead of the cell text.
+///
+struct NumericValue
+{
+    double Value = 0.0;
+    ValueHelper::SpecialValueType Type = ValueHelper::SpecialValueType::NONE;
+    bool Valid = false;
+
+    NumericValue()
+    {
+
+    }
+
+    NumericValue(double value,
+                 ValueHelper::SpecialValueType type = ValueHelper::SpecialValueType::NONE)
+        : Value(value)
+        , Type(type)
+        , Valid(true)
+    {
+
+    }
+
+    bool isSpecial() const
+    {
+        return Type != ValueHelper::SpecialValueType::NONE;
+    }
+
+    ///
+    /// \brief Classifies a cell value. Numbers are taken as they are and only
+    ///        text cells are compared against the special value texts, which
+    ///        doesn't allocate any string.
+    /// \remark The result is invalid for anything else, e.g. labels.
+    ///
+    static NumericValue fromVariant(const QVariant &variant)
+    {
+        switch (variant.typeId()) {
+        case QMetaType::Double:
+        case QMetaType::Float:
+        case QMetaType::Int:
+        case QMetaType::UInt:
+        case QMetaType::LongLong:
+        case QMetaType::ULongLong:
+            return NumericValue(variant.toDouble());
+        case QMetaType::QString: {
+            const auto text = QStringView(*static_cast<const QString*>(variant.constData())).trimmed();
+            if (!text.compare(ValueHelper::EPSText, Qt::CaseInsensitive))
+                return NumericValue(0.0, ValueHelper::SpecialValueType::EPS);
+            if (!text.compare(ValueHelper::PINFText, Qt::CaseInsensitive))
+                return NumericValue(std::numeric_limits<double>::infinity(),
+                                    ValueHelper::SpecialValueType::P_INF);
+            if (!text.compare(ValueHelper::NINFText, Qt::CaseInsensitive))
+                return NumericValue(-std::numeric_limits<double>::infinity(),
+                                    ValueHelper::SpecialValueType::N_INF);
+            if (!text.compare(ValueHelper::INFText, Qt::CaseInsensitive))
+                return NumericValue(std::numeric_limits<double>::infinity(),
+                                    ValueHelper::SpecialValueType::INF);
+            if (!text.compare(ValueHelper::NAText, Qt::CaseInsensitive))
+                return NumericValue(std::numeric_limits<double>::quiet_NaN(),
+                                    ValueHelper::SpecialValueType::NA);
+            bool ok = false;
+            double value = text.toDouble(&ok);
+            return ok ? NumericValue(value) : NumericValue();
+        }
+        default:
+            if (variant.metaType() == QMetaType::fromType<NumericValue>())
+                return *static_cast<const NumericValue*>(variant.constData());
+            return NumericValue();
+        }
+    }
+};
+
 class ViewHelper
 {
 public:
@@ -213,7 +327,8 @@ public:
         RowEntryRole,
         ColumnEntryRole,
         DimensionRole,
-        SectionLabelRole
+        SectionLabelRole,
+        NumericDataRole
     };
 
     static QHash<int, QByteArray> roleNames()
@@ -224,7 +339,8 @@ public:
             {RowEntryRole, "rowentry"},
             {ColumnEntryRole, "columnentry"},
             {DimensionRole, "dimension"},
-            {SectionLabelRole, "sectionlabel"}
+            {SectionLabelRole, "sectionlabel"},
+            {NumericDataRole, "numericdata"}
         };
         return mapping;
     }
@@ -544,27 +660,32 @@ struct ValueFilter
     {
         if (!value.isValid())
             return false;
-        auto str = value.toString();
-        if (!str.compare(ValueHelper::PINFText, Qt::CaseInsensitive)) {
-            return ShowPInf ? true : false;
-        }
-        if (!str.compare(ValueHelper::NINFText, Qt::CaseInsensitive)) {
-            return ShowNInf ? true : false;
-        }
-        if (!str.compare(ValueHelper::EPSText, Qt::CaseInsensitive)) {
-            return ShowEps ? true : false;
-        }
-        bool ok;
-        double val = UseAbsoluteValues ? abs(value.toDouble(&ok))
-                                       : value.toDouble(&ok);
-        if (!ok)
+        return accepts(NumericValue::fromVariant(value));
+    }
+
+    bool accepts(const NumericValue &value) const
+    {
+        if (!value.Valid)
+            return false;
+        switch (value.Type) {
+        case ValueHelper::SpecialValueType::P_INF:
+        case ValueHelper::SpecialValueType::INF:
+            return ShowPInf;
+        case ValueHelper::SpecialValueType::N_INF:
+            return ShowNInf;
+        case ValueHelper::SpecialValueType::EPS:
+            return ShowEps;
+        case ValueHelper::SpecialValueType::NA:
             return false;
+        default:
+            break;
+        }
+        double val = UseAbsoluteValues ? std::abs(value.Value) : value.Value;
         if (ExcludeRange) {
             return val < MinValue || val > MaxValue;
         } else {
             return val >= MinValue && val <= MaxValue;
         }
-        return false;
     }
 
     bool operator==(const ValueFilter& other) const
@@ -587,4 +708,6 @@ struct ValueFilter
 }
 }
 
+Q_DECLARE_METATYPE(gams::studio::mii::NumericValue)
+
 #endif // COMMON_H
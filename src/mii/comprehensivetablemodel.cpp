@@ -72,6 +72,10 @@ QVariant ComprehensiveTableModel::data(const QModelIndex &index, int role) const
     if (role == Qt::DisplayRole && index.isValid()) {
         return mModelInstance->data(index.row(), index.column(), mView);
     }
+    if (role == ViewHelper::NumericDataRole && index.isValid()) {
+        auto value = mModelInstance->numericData(index.row(), index.column(), mView);
+        return value.Valid ? QVariant::fromValue(value) : QVariant();
+    }
     return QVariant();
 }
 
@@ -178,6 +182,10 @@ QVariant BPOverviewTableModel::data(const QModelIndex &index, int role) const
             return ValueHelper::PlusMinus;
         return QChar(value);
     }
+    if (role == ViewHelper::NumericDataRole) {
+        // the cells are sign codes, not values
+        return QVariant();
+    }
     return ComprehensiveTableModel::data(index, role);
 }
 
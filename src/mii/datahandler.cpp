@@ -22,12 +22,16 @@
 #include "abstractmodelinstance.h"
 #include "aggregation.h"
 #include "datamatrix.h"
+#include "densematrix.h"
 #include "postopttreeitem.h"
+#include "reduction.h"
+#include "symbolfiltermodel.h"
 #include "viewconfigurationprovider.h"
 
 #include <algorithm>
 #include <functional>
 
+#include <QHash>
 #include <QSet>
 
 #include <QDebug>
@@ -59,7 +63,13 @@ protected:
         , mDataHandler(other.mDataHandler)
         , mModelInstance(other.mModelInstance)
         , mLogicalSectionMapping(other.mLogicalSectionMapping)
+        , mSectionIndex(other.mSectionIndex)
         , mViewConfig(other.mViewConfig->clone())
+        , mDataMinimum(other.mDataMinimum)
+        , mDataMaximum(other.mDataMaximum)
+        , mLoadedSymbols(other.mLoadedSymbols)
+        , mLoadedAggregationType(other.mLoadedAggregationType)
+        , mLoadedAggregation(other.mLoadedAggregation)
     {
 
     }
@@ -72,7 +82,13 @@ protected:
         , mDataHandler(other.mDataHandler)
         , mModelInstance(other.mModelInstance)
         , mLogicalSectionMapping(std::move(other.mLogicalSectionMapping))
+        , mSectionIndex(std::move(other.mSectionIndex))
         , mViewConfig(std::move(other.mViewConfig))
+        , mDataMinimum(other.mDataMinimum)
+        , mDataMaximum(other.mDataMaximum)
+        , mLoadedSymbols(std::move(other.mLoadedSymbols))
+        , mLoadedAggregationType(other.mLoadedAggregationType)
+        , mLoadedAggregation(std::move(other.mLoadedAggregation))
     {
         other.mViewConfig = nullptr;
         other.mRowCount = 0;
@@ -86,13 +102,43 @@ public:
     {
     }
 
-    DataRow* dataRow(int row)
+    DataRow dataRow(int row)
     {
         return mDataHandler->mDataMatrix->row(row);
     }
 
+    QSharedPointer<DataMatrix> dataMatrix() const
+    {
+        return mDataHandler->mDataMatrix;
+    }
+
+    const QVector<int>& equationIndex() const
+    {
+        return mDataHandler->mEquationIndex;
+    }
+
+    const QVector<int>& variableIndex() const
+    {
+        return mDataHandler->mVariableIndex;
+    }
+
+    const QVector<double>& rhs() const
+    {
+        return mDataHandler->mRhs;
+    }
+
     virtual void loadData() = 0;
 
+    ///
+    /// \brief Applies a changed value filter, e.g. the absolute value
+    ///        toggle, to the loaded data.
+    /// \return <c>false</c> if the data has to be loaded again.
+    ///
+    virtual bool updateValueFilter()
+    {
+        return false;
+    }
+
     virtual double data(int row, int column) const = 0;
 
     virtual int nlFlag(int row, int column) const
@@ -121,6 +167,32 @@ public:
         return -1;
     }
 
+    ///
+    /// \brief Logical indices whose header shows <c>section</c>, i.e. the
+    ///        inverse of headerData().
+    ///
+    QList<int> logicalIndices(Qt::Orientation orientation, int section) const
+    {
+        auto index = mSectionIndex.constFind(orientation);
+        return index == mSectionIndex.constEnd() ? QList<int>() : index->values(section);
+    }
+
+    ///
+    /// \brief Builds the inverse of the logical section mapping, which has
+    ///        to be called after loadData().
+    ///
+    void indexSections()
+    {
+        mSectionIndex.clear();
+        for (auto orientation : {Qt::Horizontal, Qt::Vertical}) {
+            const auto& mapping = mLogicalSectionMapping[orientation];
+            auto& index = mSectionIndex[orientation];
+            index.reserve(mapping.size());
+            for (int logicalIndex=0; logicalIndex<mapping.size(); ++logicalIndex)
+                index.insert(mapping.at(logicalIndex), logicalIndex);
+        }
+    }
+
     QVariant sectionLabels(Qt::Orientation orientation, int logicalIndex) const
     {
         const auto& labels = mViewConfig->sectionLabels(orientation);
@@ -182,7 +254,13 @@ public:
         mDataHandler = other.mDataHandler;
         mModelInstance = other.mModelInstance;
         mLogicalSectionMapping = other.mLogicalSectionMapping;
+        mSectionIndex = other.mSectionIndex;
         mViewConfig = QSharedPointer<AbstractViewConfiguration>(other.mViewConfig->clone());
+        mDataMinimum = other.mDataMinimum;
+        mDataMaximum = other.mDataMaximum;
+        mLoadedSymbols = other.mLoadedSymbols;
+        mLoadedAggregationType = other.mLoadedAggregationType;
+        mLoadedAggregation = other.mLoadedAggregation;
         return *this;
     }
 
@@ -199,10 +277,73 @@ public:
         mDataHandler = other.mDataHandler;
         mModelInstance = other.mModelInstance;
         mLogicalSectionMapping = std::move(other.mLogicalSectionMapping);
+        mSectionIndex = std::move(other.mSectionIndex);
         mViewConfig = std::move(other.mViewConfig);
+        mDataMinimum = other.mDataMinimum;
+        mDataMaximum = other.mDataMaximum;
+        mLoadedSymbols = std::move(other.mLoadedSymbols);
+        mLoadedAggregationType = other.mLoadedAggregationType;
+        mLoadedAggregation = std::move(other.mLoadedAggregation);
         return *this;
     }
 
+protected:
+    ///
+    /// \brief Symbols of <c>orientation</c> which are not unchecked by the
+    ///        current identifier filter.
+    ///
+    QList<int> checkedSymbols(Qt::Orientation orientation) const
+    {
+        QList<int> symbols;
+        const auto& states = mViewConfig->currentIdentifierFilter()[orientation];
+        for (auto iter=states.constBegin(); iter!=states.constEnd(); ++iter) {
+            if (iter->Checked != Qt::Unchecked)
+                symbols.append(iter->SymbolIndex);
+        }
+        return symbols;
+    }
+
+    ///
+    /// \brief Aggregation type and aggregated dimensions of each symbol of
+    ///        <c>orientation</c>, i.e. everything except the absolute value
+    ///        state which defines the aggregated sections and cells.
+    ///
+    QMap<int, IndexCheckStates> aggregatedDimensions(Qt::Orientation orientation) const
+    {
+        QMap<int, IndexCheckStates> dimensions;
+        const auto& symbols = mViewConfig->currentAggregation().aggregationMap().value(orientation);
+        for (auto iter=symbols.constBegin(); iter!=symbols.constEnd(); ++iter) {
+            dimensions[iter.key()] = iter->checkStates();
+        }
+        return dimensions;
+    }
+
+    ///
+    /// \brief Remembers the checked symbols and the aggregation the loaded
+    ///        sections are based on.
+    ///
+    void storeLoadedState()
+    {
+        mLoadedSymbols[Qt::Horizontal] = checkedSymbols(Qt::Horizontal);
+        mLoadedSymbols[Qt::Vertical] = checkedSymbols(Qt::Vertical);
+        mLoadedAggregationType = mViewConfig->currentAggregation().type();
+        mLoadedAggregation[Qt::Horizontal] = aggregatedDimensions(Qt::Horizontal);
+        mLoadedAggregation[Qt::Vertical] = aggregatedDimensions(Qt::Vertical);
+    }
+
+    ///
+    /// \brief Checks if the identifier filter or the aggregation changed the
+    ///        sections since the data was loaded.
+    ///
+    bool loadedStateChanged() const
+    {
+        return mLoadedSymbols.value(Qt::Horizontal) != checkedSymbols(Qt::Horizontal) ||
+               mLoadedSymbols.value(Qt::Vertical) != checkedSymbols(Qt::Vertical) ||
+               mLoadedAggregationType != mViewConfig->currentAggregation().type() ||
+               mLoadedAggregation.value(Qt::Horizontal) != aggregatedDimensions(Qt::Horizontal) ||
+               mLoadedAggregation.value(Qt::Vertical) != aggregatedDimensions(Qt::Vertical);
+    }
+
 protected:
     int mRowCount = 0;
     int mColumnCount = 0;
@@ -211,9 +352,13 @@ protected:
     DataHandler *mDataHandler;
     AbstractModelInstance& mModelInstance;
     SectionMapping mLogicalSectionMapping;
+    QMap<Qt::Orientation, QMultiHash<int, int>> mSectionIndex;
     QSharedPointer<AbstractViewConfiguration> mViewConfig;
     double mDataMinimum = std::numeric_limits<double>::lowest();
     double mDataMaximum = std::numeric_limits<double>::max();
+    QMap<Qt::Orientation, QList<int>> mLoadedSymbols;
+    Aggregation::Type mLoadedAggregationType = Aggregation::None;
+    QMap<Qt::Orientation, QMap<int, IndexCheckStates>> mLoadedAggregation;
 };
 
 class IdentityDataProvider : public DataHandler::AbstractDataProvider
@@ -243,13 +388,136 @@ public:
     }
 };
 
+///
+/// \brief Cells of a block pattern view around the (equation symbol,
+///        variable symbol) blocks.
+/// \remark Only the equation columns right of the blocks and the total rows
+///         below them are stored. The block cells are derived from the
+///         populated blocks of the coefficient info, i.e. no dense symbol
+///         grid is needed.
+///
+template<typename T>
+class BlockPatternMargins
+{
+public:
+    ///
+    /// \brief Writable cells of detached margins.
+    /// \remark The cells are valid until the margins are copied, assigned or
+    ///         destroyed.
+    ///
+    class Cells
+    {
+    public:
+        inline T& operator()(int row, int column) const
+        {
+            if (row < mSymbolRowCount)
+                return mColumns[row][column-mSymbolColumnCount];
+            return mRows[row-mSymbolRowCount][column];
+        }
+
+        ///
+        /// \brief First cell of a total <c>row</c> below the blocks.
+        ///
+        inline T* totalRow(int row) const
+        {
+            return mRows[row-mSymbolRowCount];
+        }
+
+        inline void uniteNlFlag(int row, int column, bool flag) const
+        {
+            if (row < mSymbolRowCount)
+                mColumnFlags.unite(row, column-mSymbolColumnCount, flag);
+            else
+                mRowFlags.unite(row-mSymbolRowCount, column, flag);
+        }
+
+    private:
+        friend class BlockPatternMargins;
+
+        Cells(BlockPatternMargins &margins)
+            : mSymbolRowCount(margins.mSymbolRowCount)
+            , mSymbolColumnCount(margins.mSymbolColumnCount)
+            , mColumns(margins.mColumns.cells())
+            , mRows(margins.mRows.cells())
+            , mColumnFlags(margins.mColumnFlags.flags())
+            , mRowFlags(margins.mRowFlags.flags())
+        {
+
+        }
+
+    private:
+        int mSymbolRowCount;
+        int mSymbolColumnCount;
+        typename DenseMatrix<T>::Cells mColumns;
+        typename DenseMatrix<T>::Cells mRows;
+        NlFlagMatrix::Flags mColumnFlags;
+        NlFlagMatrix::Flags mRowFlags;
+    };
+
+    BlockPatternMargins()
+    {
+
+    }
+
+    BlockPatternMargins(int symbolRowCount, int symbolColumnCount,
+                        int rowCount, int columnCount)
+        : mSymbolRowCount(symbolRowCount)
+        , mSymbolColumnCount(symbolColumnCount)
+        , mColumns(symbolRowCount, columnCount-symbolColumnCount, T())
+        , mRows(rowCount-symbolRowCount, columnCount, T())
+        , mColumnFlags(symbolRowCount, columnCount-symbolColumnCount)
+        , mRowFlags(rowCount-symbolRowCount, columnCount)
+    {
+
+    }
+
+    ///
+    /// \brief Checks if the cell belongs to an (equation symbol, variable
+    ///        symbol) block, which isn't stored by the margins.
+    ///
+    inline bool isBlock(int row, int column) const
+    {
+        return row < mSymbolRowCount && column < mSymbolColumnCount;
+    }
+
+    inline T value(int row, int column) const
+    {
+        if (row < mSymbolRowCount)
+            return mColumns[row][column-mSymbolColumnCount];
+        return mRows[row-mSymbolRowCount][column];
+    }
+
+    inline bool nlFlag(int row, int column) const
+    {
+        if (row < mSymbolRowCount)
+            return mColumnFlags.test(row, column-mSymbolColumnCount);
+        return mRowFlags.test(row-mSymbolRowCount, column);
+    }
+
+    ///
+    /// \brief Detaches the margins once and returns their writable cells.
+    ///
+    Cells cells()
+    {
+        return Cells(*this);
+    }
+
+private:
+    int mSymbolRowCount = 0;
+    int mSymbolColumnCount = 0;
+    DenseMatrix<T> mColumns;
+    DenseMatrix<T> mRows;
+    NlFlagMatrix mColumnFlags;
+    NlFlagMatrix mRowFlags;
+};
+
 class BPScalingProvider final : public DataHandler::AbstractDataProvider
 {
 public:
     BPScalingProvider(DataHandler *dataHandler,
                       AbstractModelInstance& modelInstance,
                       const QSharedPointer<AbstractViewConfiguration> &viewConfig,
-                      const QSharedPointer<DataHandler::CoefficientInfo> &coeffInfo)
+                      const QSharedPointer<const DataHandler::CoefficientInfo> &coeffInfo)
         : DataHandler::AbstractDataProvider(dataHandler, modelInstance, viewConfig)
         , mCoeffInfo(coeffInfo)
     {
@@ -257,58 +525,13 @@ public:
         mRowCount = mSymbolRowCount + 2; // one row for max and min
         mSymbolColumnCount = mModelInstance.variableCount();
         mColumnCount = mSymbolColumnCount + 2;
-        mDataMatrix = new double*[mRowCount];
-        mNlFlags = new int*[mRowCount];
-        for (int r=0; r<mRowCount; ++r) {
-            mDataMatrix[r] = new double[mColumnCount];
-            mNlFlags[r] = new int[mColumnCount];
-            std::fill(mNlFlags[r], mNlFlags[r]+mColumnCount, 0);
-            if (r % 2) {
-                std::fill(mDataMatrix[r], mDataMatrix[r]+mColumnCount,
-                          std::numeric_limits<double>::max());
-            } else {
-                std::fill(mDataMatrix[r], mDataMatrix[r]+mColumnCount,
-                          std::numeric_limits<double>::lowest());
-            }
-        }
+        mMargins = BlockPatternMargins<double>(mSymbolRowCount, mSymbolColumnCount,
+                                               mRowCount, mColumnCount);
         mDataMinimum = std::numeric_limits<double>::max();
         mDataMaximum = std::numeric_limits<double>::lowest();
     }
 
-    BPScalingProvider(const BPScalingProvider& other)
-        : DataHandler::AbstractDataProvider(other)
-        , mDataMatrix(new double*[mRowCount])
-        , mCoeffInfo(other.mCoeffInfo)
-        , mNlFlags(new int*[mRowCount])
-    {
-        for (int r=0; r<mRowCount; ++r) {
-            mDataMatrix[r] = new double[mColumnCount];
-            mNlFlags[r] = new int[mColumnCount];
-            std::copy(other.mDataMatrix[r],
-                      other.mDataMatrix[r]+other.mColumnCount, mDataMatrix[r]);
-            std::copy(other.mNlFlags[r], other.mNlFlags[r]+other.mColumnCount, mNlFlags[r]);
-        }
-    }
-
-    BPScalingProvider(BPScalingProvider&& other) noexcept
-        : DataHandler::AbstractDataProvider(std::move(other))
-        , mDataMatrix(other.mDataMatrix)
-        , mCoeffInfo(std::move(other.mCoeffInfo))
-        , mNlFlags(other.mNlFlags)
-    {
-        other.mDataMatrix = nullptr;
-        other.mNlFlags = nullptr;
-    }
-
-    ~BPScalingProvider() override
-    {
-        for (int r=0; r<mRowCount; ++r) {
-            delete [] mDataMatrix[r];
-            delete [] mNlFlags[r];
-        }
-        delete [] mDataMatrix;
-        delete [] mNlFlags;
-    }
+    BPScalingProvider(const BPScalingProvider& other) = default;
 
     void loadData() override
     {
@@ -319,230 +542,164 @@ public:
         for (const auto& variable : mModelInstance.variables()) {
             mLogicalSectionMapping[Qt::Horizontal].append(variable->firstSection());
         }
-        mViewConfig->currentValueFilter().isAbsolute() ? aggregateAbs() : aggregateId();
-    }
-
-    double data(int row, int column) const override
-    {
-        return mDataMatrix[row][column];
+        mAbsolute = mViewConfig->currentValueFilter().isAbsolute();
+        aggregate(mAbsolute);
     }
 
-    int nlFlag(int row, int column) const override
+    bool updateValueFilter() override
     {
-        return mNlFlags[row][column];
+        // the extrema depend on the absolute state, i.e. a changed state
+        // requires a new aggregation
+        return mAbsolute == mViewConfig->currentValueFilter().isAbsolute();
     }
 
-    auto& operator=(const BPScalingProvider& other)
+    double data(int row, int column) const override
     {
-        for (int r=0; r<mRowCount; ++r) {
-            delete [] mDataMatrix[r];
-            delete [] mNlFlags[r];
-        }
-        if (mDataMatrix) delete [] mDataMatrix;
-        if (mNlFlags) delete [] mNlFlags;
-        mDataMatrix = new double*[mRowCount];
-        mNlFlags = new int*[mRowCount];
-        for (int r=0; r<mRowCount; ++r) {
-            mDataMatrix[r] = new double[mColumnCount];
-            mNlFlags[r] = new int[mColumnCount];
-            std::copy(other.mDataMatrix[r], other.mDataMatrix[r]+other.mColumnCount, mDataMatrix[r]);
-            std::copy(other.mNlFlags[r], other.mNlFlags[r]+other.mColumnCount, mNlFlags[r]);
+        if (mMargins.isBlock(row, column)) {
+            int block = mCoeffInfo->block(row/2, column);
+            if (block < 0)
+                return 0.0;
+            return row % 2 ? mBlockMinimum[block] : mBlockMaximum[block];
         }
-        mCoeffInfo = other.mCoeffInfo;
-        return *this;
+        return mMargins.value(row, column);
     }
 
-    auto& operator=(BPScalingProvider&& other) noexcept
+    int nlFlag(int row, int column) const override
     {
-        mDataMatrix = other.mDataMatrix;
-        other.mDataMatrix = nullptr;
-        mCoeffInfo = std::move(other.mCoeffInfo);
-        mNlFlags = other.mNlFlags;
-        other.mNlFlags = nullptr;
-        return *this;
+        if (mMargins.isBlock(row, column))
+            return mCoeffInfo->nlFlag(row/2, column);
+        return mMargins.nlFlag(row, column);
     }
 
 private:
-    void aggregateId()
-    {
-        int minRow = 1, maxRow = 0;
+    ///
+    /// \brief Aggregates the extrema of each (equation symbol, variable
+    ///        symbol) block.
+    /// \remark Only the populated blocks of the coefficient info are visited,
+    ///         which are looked up by the variable symbol while sweeping the
+    ///         sparse rows of each equation symbol.
+    ///
+    void aggregate(bool absolute)
+    {
+        auto cells = mMargins.cells();
+        const auto& coeffInfo = *mCoeffInfo;
+        const int rhsColumn = mSymbolColumnCount;
+        const int eqnColumn = mSymbolColumnCount + 1;
+        const int maxTotals = mRowCount - 2;
+        const int minTotals = mRowCount - 1;
+        mBlockMinimum.fill(std::numeric_limits<double>::max(), coeffInfo.blockCount());
+        mBlockMaximum.fill(std::numeric_limits<double>::lowest(), coeffInfo.blockCount());
+        // only the totals start with the extrema, the blocks are set directly
+        std::fill(cells.totalRow(maxTotals), cells.totalRow(maxTotals)+mColumnCount,
+                  std::numeric_limits<double>::lowest());
+        std::fill(cells.totalRow(minTotals), cells.totalRow(minTotals)+mColumnCount,
+                  std::numeric_limits<double>::max());
+        QVector<int> blockIndex(mSymbolColumnCount, -1);
+        const int* variableIndex = this->variableIndex().constData();
+        const double* rhsValues = rhs().constData();
+        int equationIndex = 0, minRow = 1, maxRow = 0;
         for (const auto& equation : mModelInstance.equations()) {
             double rhsMin = std::numeric_limits<double>::max();
             double rhsMax = std::numeric_limits<double>::lowest();
             double eqnMin = std::numeric_limits<double>::max();
             double eqnMax = std::numeric_limits<double>::lowest();
-            mCoeffInfo->count()[maxRow][mColumnCount-2] = mModelInstance.equationType(equation->firstSection());
+            const int firstBlock = coeffInfo.firstBlock(equationIndex);
+            const int blockCount = coeffInfo.blockCount(equationIndex);
+            const int* columns = coeffInfo.blockColumns(equationIndex);
+            for (int b=0; b<blockCount; ++b) {
+                blockIndex[columns[b]] = firstBlock + b;
+            }
             for (int r=equation->firstSection(); r<=equation->lastSection(); ++r) {
                 auto sparseRow = dataRow(r);
-                auto data = mModelInstance.useOutput() ? sparseRow->outputData() : sparseRow->inputData();
-                auto rhs = mModelInstance.rhs(r);
+                auto data = mModelInstance.useOutput() ? sparseRow.outputData() : sparseRow.inputData();
+                auto rhs = rhsValues[r];
                 if (rhs != 0.0) {
-                    rhsMin = std::min(rhsMin, rhs);
-                    rhsMax = std::max(rhsMax, rhs);
-                    if (rhs < 0) ++mCoeffInfo->count()[minRow][mColumnCount-1];
-                    else if (rhs > 0) ++mCoeffInfo->count()[maxRow][mColumnCount-1];
+                    rhsMin = std::min(rhsMin, absolute ? std::abs(rhs) : rhs);
+                    rhsMax = std::max(rhsMax, absolute ? std::abs(rhs) : rhs);
                 }
-                for (int i=0; i<sparseRow->entries(); ++i) {
-                    auto value = data[i];
-                    auto column = mModelInstance.variable(sparseRow->colIdx()[i])->logicalIndex();
-                    if (sparseRow->nlFlags()[i]) {
-                        ++mCoeffInfo->nlFlags()[minRow][column];
-                        ++mCoeffInfo->nlFlags()[maxRow][column];
-                        ++mNlFlags[minRow][column];
-                        ++mNlFlags[maxRow][column];
-                    }
-                    mDataMatrix[minRow][column] = std::min(value, mDataMatrix[minRow][column]);
-                    mDataMatrix[maxRow][column] = std::max(value, mDataMatrix[maxRow][column]);
-                    if (value < 0) {
-                        ++mCoeffInfo->count()[minRow][column];
-                    } else if (value > 0) {
-                        ++mCoeffInfo->count()[maxRow][column];
-                    }
+                for (int i=0; i<sparseRow.entries(); ++i) {
+                    auto extremum = absolute ? std::abs(data[i]) : data[i];
+                    auto block = blockIndex[variableIndex[sparseRow.colIdx()[i]]];
+                    mBlockMinimum[block] = std::min(extremum, mBlockMinimum[block]);
+                    mBlockMaximum[block] = std::max(extremum, mBlockMaximum[block]);
                 }
             }
-            mDataMatrix[minRow][mColumnCount-2] = rhsMin;
-            mDataMatrix[maxRow][mColumnCount-2] = rhsMax;
-            mDataMatrix[mRowCount-1][mColumnCount-2] = std::min(mDataMatrix[mRowCount-1][mColumnCount-2], rhsMin);
-            mDataMatrix[mRowCount-2][mColumnCount-2] = std::max(mDataMatrix[mRowCount-2][mColumnCount-2], rhsMax);
-            for (int c=0; c<mColumnCount-2; ++c) {
-                mDataMinimum = std::min(mDataMinimum, mDataMatrix[minRow][c]);
-                mDataMaximum = std::max(mDataMaximum, mDataMatrix[maxRow][c]);
-                mDataMatrix[mRowCount-1][c] = std::min(mDataMatrix[mRowCount-1][c], mDataMatrix[minRow][c]);
-                mDataMatrix[mRowCount-2][c] = std::max(mDataMatrix[mRowCount-2][c], mDataMatrix[maxRow][c]);
-                mNlFlags[mRowCount-1][c] += mNlFlags[minRow][c];
-                mNlFlags[mRowCount-2][c] += mNlFlags[maxRow][c];
-                eqnMin = std::min(eqnMin, mDataMatrix[minRow][c]);
-                eqnMax = std::max(eqnMax, mDataMatrix[maxRow][c]);
-                mNlFlags[minRow][mColumnCount-1] += mNlFlags[minRow][c];
-                mNlFlags[maxRow][mColumnCount-1] += mNlFlags[maxRow][c];
-                setEmtpyCell(minRow, c);
-                setEmtpyCell(maxRow, c);
+            for (int b=firstBlock; b<firstBlock+blockCount; ++b) {
+                int c = columns[b-firstBlock];
+                bool nlFlag = coeffInfo.nlFlag(b);
+                cells(minTotals, c) = std::min(cells(minTotals, c), mBlockMinimum[b]);
+                cells(maxTotals, c) = std::max(cells(maxTotals, c), mBlockMaximum[b]);
+                cells.uniteNlFlag(minTotals, c, nlFlag);
+                cells.uniteNlFlag(maxTotals, c, nlFlag);
+                cells.uniteNlFlag(minRow, eqnColumn, nlFlag);
+                cells.uniteNlFlag(maxRow, eqnColumn, nlFlag);
             }
-            mDataMatrix[minRow][mColumnCount-1] = eqnMin;
-            mDataMatrix[maxRow][mColumnCount-1] = eqnMax;
-            for (int c=mColumnCount-2; c<mColumnCount; ++c) {
-                mDataMinimum = std::min(mDataMinimum, mDataMatrix[minRow][c]);
-                mDataMaximum = std::max(mDataMaximum, mDataMatrix[maxRow][c]);
-                setEmtpyCell(minRow, c);
-                setEmtpyCell(maxRow, c);
+            cells(minRow, rhsColumn) = rhsMin;
+            cells(maxRow, rhsColumn) = rhsMax;
+            cells(minTotals, rhsColumn) = std::min(cells(minTotals, rhsColumn), rhsMin);
+            cells(maxTotals, rhsColumn) = std::max(cells(maxTotals, rhsColumn), rhsMax);
+            reduceExtrema(firstBlock, blockCount, eqnMin, eqnMax);
+            cells(minRow, eqnColumn) = eqnMin;
+            cells(maxRow, eqnColumn) = eqnMax;
+            for (int c=rhsColumn; c<mColumnCount; ++c) {
+                mDataMinimum = std::min(mDataMinimum, cells(minRow, c));
+                mDataMaximum = std::max(mDataMaximum, cells(maxRow, c));
+                setEmtpyCell(cells, minRow, c);
+                setEmtpyCell(cells, maxRow, c);
             }
+            ++equationIndex;
             minRow += 2;
             maxRow += 2;
         }
-        setEmtpyCell(mRowCount-2, mColumnCount-2);
-        setEmtpyCell(mRowCount-1, mColumnCount-2);
-        mDataMatrix[mRowCount-2][mColumnCount-1] = 0.0;
-        mDataMatrix[mRowCount-1][mColumnCount-1] = 0.0;
+        // variables without any nonzero keep the initial extrema in the totals
+        Reduction::clearExtremaStart(cells.totalRow(minTotals), mSymbolColumnCount);
+        Reduction::clearExtremaStart(cells.totalRow(maxTotals), mSymbolColumnCount);
+        setEmtpyCell(cells, maxTotals, rhsColumn);
+        setEmtpyCell(cells, minTotals, rhsColumn);
+        cells(maxTotals, eqnColumn) = 0.0;
+        cells(minTotals, eqnColumn) = 0.0;
         if (!mViewConfig->defaultValueFilter().minMaxChanged()) {
             mViewConfig->defaultValueFilter().MinValue = mDataMinimum;
             mViewConfig->defaultValueFilter().MaxValue = mDataMaximum;
         }
-        if (mViewConfig->currentValueFilter().PreviousAbsolute != mViewConfig->currentValueFilter().isAbsolute()) {
-            mViewConfig->currentValueFilter().MinValue = mDataMinimum;
-            mViewConfig->currentValueFilter().MaxValue = mDataMaximum;
-        } else if (!mViewConfig->currentValueFilter().minMaxChanged()) {
-            mViewConfig->currentValueFilter().MinValue = mDataMinimum;
-            mViewConfig->currentValueFilter().MaxValue = mDataMaximum;
+        auto& filter = mViewConfig->currentValueFilter();
+        if (filter.PreviousAbsolute != filter.isAbsolute() || !filter.minMaxChanged() ||
+                (absolute && filter.UseAbsoluteValuesGlobal)) {
+            filter.MinValue = mDataMinimum;
+            filter.MaxValue = mDataMaximum;
         }
         mDataHandler->setModelMinimum(mDataMinimum);
         mDataHandler->setModelMaximum(mDataMaximum);
     }
 
-    void aggregateAbs()
+    ///
+    /// \brief Reduces the extrema of the <c>count</c> blocks starting at
+    ///        <c>firstBlock</c> into the equation extrema and the data range.
+    /// \remark The block extrema are contiguous per equation symbol, i.e.
+    ///         each equation symbol is reduced in one sweep.
+    ///
+    void reduceExtrema(int firstBlock, int count, double &eqnMin, double &eqnMax)
     {
-        int minRow = 1, maxRow = 0;
-        for (const auto& equation : mModelInstance.equations()) {
-            double rhsMin = std::numeric_limits<double>::max();
-            double rhsMax = std::numeric_limits<double>::lowest();
-            double eqnMin = std::numeric_limits<double>::max();
-            double eqnMax = std::numeric_limits<double>::lowest();
-            mCoeffInfo->count()[maxRow][mColumnCount-2] = mModelInstance.equationType(equation->firstSection());
-            for (int r=equation->firstSection(); r<=equation->lastSection(); ++r) {
-                auto sparseRow = dataRow(r);
-                auto data = mModelInstance.useOutput() ? sparseRow->outputData() : sparseRow->inputData();
-                auto rhs = mModelInstance.rhs(r);
-                if (rhs != 0.0) {
-                    rhsMin = std::min(rhsMin, std::abs(rhs));
-                    rhsMax = std::max(rhsMax, std::abs(rhs));
-                    if (rhs < 0) ++mCoeffInfo->count()[minRow][mColumnCount-1];
-                    else if (rhs > 0) ++mCoeffInfo->count()[maxRow][mColumnCount-1];
-                }
-                for (int i=0; i<sparseRow->entries(); ++i) {
-                    auto value = data[i];
-                    auto column = mModelInstance.variable(sparseRow->colIdx()[i])->logicalIndex();
-                    if (sparseRow->nlFlags()[i]) {
-                        ++mCoeffInfo->nlFlags()[minRow][column];
-                        ++mCoeffInfo->nlFlags()[maxRow][column];
-                        ++mNlFlags[minRow][column];
-                        ++mNlFlags[maxRow][column];
-                    }
-                    mDataMatrix[minRow][column] = std::min(std::abs(data[i]), mDataMatrix[minRow][column]);
-                    mDataMatrix[maxRow][column] = std::max(std::abs(data[i]), mDataMatrix[maxRow][column]);
-                    if (value < 0) {
-                        ++mCoeffInfo->count()[minRow][column];
-                    } else if (value > 0) {
-                        ++mCoeffInfo->count()[maxRow][column];
-                    }
-                }
-            }
-            mDataMatrix[minRow][mColumnCount-2] = rhsMin;
-            mDataMatrix[maxRow][mColumnCount-2] = rhsMax;
-            mDataMatrix[mRowCount-1][mColumnCount-2] = std::min(mDataMatrix[mRowCount-1][mColumnCount-2], rhsMin);
-            mDataMatrix[mRowCount-2][mColumnCount-2] = std::max(mDataMatrix[mRowCount-2][mColumnCount-2], rhsMax);
-            for (int c=0; c<mColumnCount-2; ++c) {
-                mDataMinimum = std::min(mDataMinimum, mDataMatrix[minRow][c]);
-                mDataMaximum = std::max(mDataMaximum, mDataMatrix[maxRow][c]);
-                mDataMatrix[mRowCount-1][c] = std::min(mDataMatrix[mRowCount-1][c], mDataMatrix[minRow][c]);
-                mDataMatrix[mRowCount-2][c] = std::max(mDataMatrix[mRowCount-2][c], mDataMatrix[maxRow][c]);
-                mNlFlags[mRowCount-1][c] += mNlFlags[minRow][c];
-                mNlFlags[mRowCount-2][c] += mNlFlags[maxRow][c];
-                eqnMin = std::min(eqnMin, mDataMatrix[minRow][c]);
-                eqnMax = std::max(eqnMax, mDataMatrix[maxRow][c]);
-                mNlFlags[minRow][mColumnCount-1] += mNlFlags[minRow][c];
-                mNlFlags[maxRow][mColumnCount-1] += mNlFlags[maxRow][c];
-                setEmtpyCell(minRow, c);
-                setEmtpyCell(maxRow, c);
-            }
-            mDataMatrix[minRow][mColumnCount-1] = eqnMin;
-            mDataMatrix[maxRow][mColumnCount-1] = eqnMax;
-            for (int c=mColumnCount-2; c<mColumnCount; ++c) {
-                mDataMinimum = std::min(mDataMinimum, mDataMatrix[minRow][c]);
-                mDataMaximum = std::max(mDataMaximum, mDataMatrix[maxRow][c]);
-                setEmtpyCell(minRow, c);
-                setEmtpyCell(maxRow, c);
-            }
-            minRow += 2;
-            maxRow += 2;
-        }
-        setEmtpyCell(mRowCount-2, mColumnCount-2);
-        setEmtpyCell(mRowCount-1, mColumnCount-2);
-        mDataMatrix[mRowCount-2][mColumnCount-1] = 0.0;
-        mDataMatrix[mRowCount-1][mColumnCount-1] = 0.0;
-        if (!mViewConfig->defaultValueFilter().minMaxChanged()) {
-            mViewConfig->defaultValueFilter().MinValue = mDataMinimum;
-            mViewConfig->defaultValueFilter().MaxValue = mDataMaximum;
-        }
-        if (mViewConfig->currentValueFilter().PreviousAbsolute != mViewConfig->currentValueFilter().isAbsolute() ||
-            !mViewConfig->currentValueFilter().minMaxChanged() || mViewConfig->currentValueFilter().UseAbsoluteValuesGlobal) {
-            mViewConfig->currentValueFilter().MinValue = mDataMinimum;
-            mViewConfig->currentValueFilter().MaxValue = mDataMaximum;
-        }
-        mDataHandler->setModelMinimum(mDataMinimum);
-        mDataHandler->setModelMaximum(mDataMaximum);
+        eqnMin = Reduction::minimum(mBlockMinimum.constData()+firstBlock, count, eqnMin);
+        eqnMax = Reduction::maximum(mBlockMaximum.constData()+firstBlock, count, eqnMax);
+        mDataMinimum = std::min(mDataMinimum, eqnMin);
+        mDataMaximum = std::max(mDataMaximum, eqnMax);
     }
 
-    void setEmtpyCell(int row, int column)
+    static void setEmtpyCell(const BlockPatternMargins<double>::Cells &cells, int row, int column)
     {
-        if (mDataMatrix[row][column] == std::numeric_limits<double>::lowest() ||
-                mDataMatrix[row][column] == std::numeric_limits<double>::max()) {
-            mDataMatrix[row][column] = 0.0;
+        if (cells(row, column) == std::numeric_limits<double>::lowest() ||
+                cells(row, column) == std::numeric_limits<double>::max()) {
+            cells(row, column) = 0.0;
         }
     }
 
 private:
-    double** mDataMatrix;
-    QSharedPointer<DataHandler::CoefficientInfo> mCoeffInfo;
-    int** mNlFlags;
+    QSharedPointer<const DataHandler::CoefficientInfo> mCoeffInfo;
+    QVector<double> mBlockMinimum;
+    QVector<double> mBlockMaximum;
+    BlockPatternMargins<double> mMargins;
+    bool mAbsolute = false;
 };
 
 class SymbolsDataProvider final : public DataHandler::AbstractDataProvider
@@ -560,10 +717,10 @@ private:
             : mEntries(other.mEntries)
             , mFirstIdx(other.mFirstIdx)
             , mData(new double[other.mEntries])
-            , mNlFlags(new int[other.mEntries])
+            , mNlFlags(new NlFlags::Word[NlFlags::words(other.mEntries)])
         {
             std::copy(other.mData, other.mData+other.mEntries, mData);
-            std::copy(other.mNlFlags, other.mNlFlags+other.mEntries, mNlFlags);
+            std::copy(other.mNlFlags, other.mNlFlags+NlFlags::words(other.mEntries), mNlFlags);
         }
 
         SymbolRow(SymbolRow&& other) noexcept
@@ -614,21 +771,31 @@ private:
             return mData;
         }
 
+        inline const double* data() const
+        {
+            return mData;
+        }
+
         inline void setData(double* data)
         {
             mData = data;
         }
 
-        inline int* nlFlags()
+        inline NlFlags::Word* nlFlags()
         {
             return mNlFlags;
         }
 
-        inline void setNlFlags(int* nlFlags)
+        inline void setNlFlags(NlFlags::Word* nlFlags)
         {
             mNlFlags = nlFlags;
         }
 
+        inline bool nlFlag(int index) const
+        {
+            return NlFlags::test(mNlFlags, index);
+        }
+
         auto& operator=(const SymbolRow& other)
         {
             if (mData) delete [] mData;
@@ -636,9 +803,9 @@ private:
             mEntries = other.mEntries;
             mFirstIdx = other.mFirstIdx;
             mData = new double[other.mEntries];
-            mNlFlags = new int[other.mEntries];
+            mNlFlags = new NlFlags::Word[NlFlags::words(other.mEntries)];
             std::copy(other.mData, other.mData+other.mEntries, mData);
-            std::copy(other.mNlFlags, other.mNlFlags+other.mEntries, mNlFlags);
+            std::copy(other.mNlFlags, other.mNlFlags+NlFlags::words(other.mEntries), mNlFlags);
             return *this;
         }
 
@@ -659,7 +826,7 @@ private:
         int mEntries = 0;
         int mFirstIdx = 0;
         double* mData = nullptr;
-        int *mNlFlags = nullptr;
+        NlFlags::Word *mNlFlags = nullptr;
     };
 
 public:
@@ -672,31 +839,7 @@ public:
         mDataMaximum = std::numeric_limits<double>::lowest();
     }
 
-    SymbolsDataProvider(const SymbolsDataProvider& other)
-        : DataHandler::AbstractDataProvider(other)
-    {
-        mRows = new SymbolRow[mRowCount];
-        std::copy(other.mRows, other.mRows+other.mRowCount, mRows);
-        mColumnEntryCount = new int[mColumnCount];
-        std::copy(other.mColumnEntryCount, other.mColumnEntryCount+other.mColumnCount, mColumnEntryCount);
-    }
-
-    SymbolsDataProvider(SymbolsDataProvider&& other) noexcept
-        : DataHandler::AbstractDataProvider(std::move(other))
-        , mRows(other.mRows)
-        , mColumnEntryCount(other.mColumnEntryCount)
-    {
-        other.mRowCount = 0;
-        other.mColumnCount = 0;
-        other.mRows = nullptr;
-        other.mColumnEntryCount = nullptr;
-    }
-
-    ~SymbolsDataProvider()
-    {
-        if (mColumnEntryCount) delete [] mColumnEntryCount;
-        if (mRows) delete [] mRows;
-    }
+    SymbolsDataProvider(const SymbolsDataProvider& other) = default;
 
     void loadData() override
     {
@@ -714,47 +857,62 @@ public:
             }
         }
         mRowCount = mLogicalSectionMapping[Qt::Vertical].size();
-        mRows = new SymbolRow[mRowCount];
-        QList<Symbol*> variables;
+        mRows.resize(mRowCount);
         for (const auto &filter : std::as_const(mViewConfig->currentIdentifierFilter()[Qt::Horizontal])) {
             if (filter.Checked == Qt::Unchecked)
                 continue;
             auto variable = mModelInstance.variable(filter.SymbolIndex);
             if (!variable)
                 continue;
-            variables.append(variable);
             mVarDimension = std::max(mVarDimension, variable->dimension());
             for (int s=variable->firstSection(); s<=variable->lastSection(); ++s) {
                 mLogicalSectionMapping[Qt::Horizontal].append(s);
             }
         }
         mColumnCount += mLogicalSectionMapping[Qt::Horizontal].size();
-        mColumnEntryCount = new int[mColumnCount];
-        std::fill(mColumnEntryCount, mColumnEntryCount+mColumnCount, 0);
-        mViewConfig->currentValueFilter().UseAbsoluteValues ? aggregateAbs(equations, variables)
-                                                            : aggregateId(equations, variables);
+        mColumnEntryCount.fill(0, mColumnCount);
+        aggregate(equations);
+        storeLoadedState();
+        mAbsolute = mViewConfig->currentValueFilter().UseAbsoluteValues;
+        updateDataRange();
+    }
+
+    ///
+    /// \brief The rows keep the signed values, i.e. only the data range is
+    ///        updated if the absolute value state changes.
+    ///
+    bool updateValueFilter() override
+    {
+        if (loadedStateChanged())
+            return false;
+        if (mAbsolute != mViewConfig->currentValueFilter().UseAbsoluteValues) {
+            mAbsolute = mViewConfig->currentValueFilter().UseAbsoluteValues;
+            updateDataRange();
+        }
+        return true;
     }
 
     double data(int row, int column) const override
     {
-        if (!mRows || !mRows[row].entries()) {
+        if (mRows.isEmpty() || !mRows[row].entries()) {
             return 0.0;
         }
         if (column < mRows[row].firstIdx() || column > mRows[row].lastIdx()) {
             return 0.0;
         }
-        return mRows[row].data()[column-mRows[row].firstIdx()];
+        auto value = mRows[row].data()[column-mRows[row].firstIdx()];
+        return mAbsolute ? std::abs(value) : value;
     }
 
     int nlFlag(int row, int column) const override
     {
-        if (!mRows || !mRows[row].entries()) {
+        if (mRows.isEmpty() || !mRows[row].entries()) {
             return 0;
         }
         if (column < mRows[row].firstIdx() || column > mRows[row].lastIdx()) {
             return 0;
         }
-        return mRows[row].nlFlags()[column-mRows[row].firstIdx()];
+        return mRows[row].nlFlag(column-mRows[row].firstIdx());
     }
 
     int columnEntries(int column) const override
@@ -772,136 +930,324 @@ public:
         return orientation == Qt::Horizontal ? mVarDimension : mEqnDimension;
     }
 
-    auto& operator=(const SymbolsDataProvider& other)
-    {
-        delete [] mRows;
-        delete [] mColumnEntryCount;
-        mRows = new SymbolRow[mRowCount];
-        std::copy(other.mRows, other.mRows+other.mRowCount, mRows);
-        mColumnEntryCount = new int[mColumnCount];
-        std::copy(other.mColumnEntryCount, other.mColumnEntryCount+other.mColumnCount, mColumnEntryCount);
-        return *this;
-    }
-
-    auto& operator=(SymbolsDataProvider&& other) noexcept
-    {
-        mRows = other.mRows;
-        other.mRows = nullptr;
-        mColumnEntryCount = other.mColumnEntryCount;
-        other.mColumnEntryCount = nullptr;
-        return *this;
-    }
-
 private:
-    void aggregateAbs(QList<Symbol*>& equations, QList<Symbol*>& variables)
-    {
+    ///
+    /// \brief Builds the symbol rows with one sweep over each sparse row.
+    /// \param equations Selected equations.
+    /// \remark The column map translates a Jacobian column directly into the
+    ///         visible column, i.e. the costs are O(nnz) regardless of the
+    ///         number of selected variables.
+    ///
+    void aggregate(const QList<Symbol*>& equations)
+    {
+        QVector<int> columnMap(mModelInstance.variableRowCount(), -1);
+        const auto& columns = mLogicalSectionMapping[Qt::Horizontal];
+        for (int c=0; c<columns.size(); ++c) {
+            if (columns[c] < columnMap.size())
+                columnMap[columns[c]] = c;
+        }
         int rr = 0;
         for (auto* equation : equations) {
             for (int r=equation->firstSection(); r<=equation->lastSection(); ++r, ++rr) {
                 auto sparseRow = dataRow(r);
-                auto data = mModelInstance.useOutput() ? sparseRow->outputData() : sparseRow->inputData();
-                int sym_nz = 0, start_i = -1, start_c = 0, end_c = 0;
-                for (auto variable : variables) {
-                    for (int i=0; i<sparseRow->entries(); ++i) {
-                        if (sparseRow->colIdx()[i] > variable->lastSection()) {
-                            break;
-                        }
-                        if (sparseRow->colIdx()[i] < variable->firstSection()) {
-                            continue;
-                        }
-                        if (start_i < 0) {
-                            start_c = sparseRow->colIdx()[i];
-                            start_i = i;
-                        }
-                        end_c = sparseRow->colIdx()[i];
-                        ++sym_nz;
-                    }
+                if (!sparseRow.entries())
+                    continue;
+                auto data = mModelInstance.useOutput() ? sparseRow.outputData() : sparseRow.inputData();
+                const int* colIdx = sparseRow.colIdx();
+                int sym_nz = 0, start_c = mColumnCount, end_c = -1;
+                for (int i=0; i<sparseRow.entries(); ++i) {
+                    int c = columnMap[colIdx[i]];
+                    if (c < 0)
+                        continue;
+                    start_c = std::min(start_c, c);
+                    end_c = std::max(end_c, c);
+                    ++sym_nz;
                 }
                 if (!sym_nz) continue;
                 SymbolRow* row = &mRows[rr];
                 row->setEntries(end_c + 1 - start_c);
+                row->setFirstIdx(start_c);
                 row->setData(new double[row->entries()]);
-                row->setNlFlags(new int[row->entries()]);
-                row->setFirstIdx(start_c - variables.first()->firstSection());
-                if (sym_nz == row->entries()) {
-                    for (int nz=start_i, c=0; nz<start_i+sym_nz; ++nz, ++c) {
-                        row->data()[c] = std::abs(data[nz]);
-                        row->nlFlags()[c] = sparseRow->nlFlags()[nz];
-                        mDataMinimum = std::min(mDataMinimum, row->data()[c]);
-                        mDataMaximum = std::max(mDataMaximum, row->data()[c]);
-                        ++mColumnEntryCount[row->firstIdx()+c];
-                    }
-                } else {
+                row->setNlFlags(new NlFlags::Word[NlFlags::words(row->entries())]);
+                std::fill(row->nlFlags(), row->nlFlags()+NlFlags::words(row->entries()), NlFlags::Word(0));
+                if (sym_nz != row->entries()) {
                     std::fill(row->data(), row->data()+row->entries(), 0.0);
-                    std::fill(row->nlFlags(), row->nlFlags()+row->entries(), 0);
-                    for (int nz=start_i, c=0; nz<start_i+sym_nz; ++nz) {
-                        c = sparseRow->colIdx()[nz] - start_c;
-                        row->data()[c] = std::abs(data[nz]);
-                        row->nlFlags()[c] = sparseRow->nlFlags()[nz];
-                        mDataMinimum = std::min(mDataMinimum, row->data()[c]);
-                        mDataMaximum = std::max(mDataMaximum, row->data()[c]);
-                        ++mColumnEntryCount[row->firstIdx()+c];
-                    }
+                }
+                for (int i=0; i<sparseRow.entries(); ++i) {
+                    int c = columnMap[colIdx[i]];
+                    if (c < 0)
+                        continue;
+                    auto value = data[i];
+                    row->data()[c-start_c] = value;
+                    if (sparseRow.nlFlag(i))
+                        NlFlags::set(row->nlFlags(), c-start_c);
+                    mSignedMinimum = std::min(mSignedMinimum, value);
+                    mSignedMaximum = std::max(mSignedMaximum, value);
+                    mAbsoluteMinimum = std::min(mAbsoluteMinimum, std::abs(value));
+                    mAbsoluteMaximum = std::max(mAbsoluteMaximum, std::abs(value));
+                    ++mColumnEntryCount[c];
                 }
             }
         }
+    }
+
+    void updateDataRange()
+    {
+        mDataMinimum = mAbsolute ? mAbsoluteMinimum : mSignedMinimum;
+        mDataMaximum = mAbsolute ? mAbsoluteMaximum : mSignedMaximum;
         mViewConfig->defaultValueFilter().MinValue = mDataMinimum;
         mViewConfig->defaultValueFilter().MaxValue = mDataMaximum;
         mViewConfig->currentValueFilter().MinValue = mDataMinimum;
         mViewConfig->currentValueFilter().MaxValue = mDataMaximum;
     }
 
-    void aggregateId(QList<Symbol*>& equations, QList<Symbol*>& variables)
+private:
+    QVector<SymbolRow> mRows;
+    QVector<int> mColumnEntryCount;
+    int mEqnDimension = 0;
+    int mVarDimension = 0;
+    bool mAbsolute = false;
+    double mSignedMinimum = std::numeric_limits<double>::max();
+    double mSignedMaximum = std::numeric_limits<double>::lowest();
+    double mAbsoluteMinimum = std::numeric_limits<double>::max();
+    double mAbsoluteMaximum = std::numeric_limits<double>::lowest();
+};
+
+///
+/// \brief Symbol view data reduced by the current aggregation, where all
+///        sections of a symbol with equal labels in the not aggregated
+///        dimensions are united.
+/// \remark Each aggregated cell is reduced from the Jacobian rows in one pass,
+///         only Median keeps the values of the current aggregated row to
+///         select the median per cell.
+///
+class AggregationDataProvider final : public DataHandler::AbstractDataProvider
+{
+public:
+    AggregationDataProvider(DataHandler *dataHandler,
+                            AbstractModelInstance& modelInstance,
+                            const QSharedPointer<AbstractViewConfiguration> &viewConfig)
+        : DataHandler::AbstractDataProvider(dataHandler, modelInstance, viewConfig)
     {
-        int rr = 0;
-        for (auto* equation : equations) {
-            for (int r=equation->firstSection(); r<=equation->lastSection(); ++r, ++rr) {
-                auto sparseRow = dataRow(r);
-                auto data = mModelInstance.useOutput() ? sparseRow->outputData() : sparseRow->inputData();
-                int sym_nz = 0, start_i = -1, start_c = 0, end_c = 0;
-                for (auto variable : variables) {
-                    for (int i=0; i<sparseRow->entries(); ++i) {
-                        if (sparseRow->colIdx()[i] > variable->lastSection()) {
-                            break;
-                        }
-                        if (sparseRow->colIdx()[i] < variable->firstSection()) {
-                            continue;
-                        }
-                        if (start_i < 0) {
-                            start_c = sparseRow->colIdx()[i];
-                            start_i = i;
-                        }
-                        end_c = sparseRow->colIdx()[i];
-                        ++sym_nz;
-                    }
+        mDataMinimum = std::numeric_limits<double>::max();
+        mDataMaximum = std::numeric_limits<double>::lowest();
+    }
+
+    AggregationDataProvider(const AggregationDataProvider& other) = default;
+
+    static bool isAggregated(const QSharedPointer<AbstractViewConfiguration> &viewConfig)
+    {
+        return viewConfig->currentAggregation().type() != Aggregation::None &&
+               viewConfig->currentAggregation().isActive();
+    }
+
+    void loadData() override
+    {
+        mRowMap = uniteSections(Qt::Vertical, mModelInstance.equationRowCount(), mEqnDimension);
+        mColumnMap = uniteSections(Qt::Horizontal, mModelInstance.variableRowCount(), mVarDimension);
+        mRowCount = mLogicalSectionMapping[Qt::Vertical].size();
+        mColumnCount = mLogicalSectionMapping[Qt::Horizontal].size();
+        storeLoadedState();
+        mAbsolute = isAbsolute();
+        reduce(mRowMap, mColumnMap);
+    }
+
+    ///
+    /// \brief The united sections are kept, i.e. a changed absolute value
+    ///        state only reduces the cells again.
+    ///
+    bool updateValueFilter() override
+    {
+        if (loadedStateChanged())
+            return false;
+        if (mAbsolute != isAbsolute()) {
+            mAbsolute = isAbsolute();
+            mDataMinimum = std::numeric_limits<double>::max();
+            mDataMaximum = std::numeric_limits<double>::lowest();
+            reduce(mRowMap, mColumnMap);
+        }
+        return true;
+    }
+
+    double data(int row, int column) const override
+    {
+        int entry = find(row, column);
+        return entry < 0 ? 0.0 : mValues[entry];
+    }
+
+    int nlFlag(int row, int column) const override
+    {
+        int entry = find(row, column);
+        return entry < 0 ? 0 : NlFlags::test(mNlFlags.constData(), entry);
+    }
+
+    int columnEntries(int column) const override
+    {
+        return column < mColumnEntryCount.size() ? mColumnEntryCount[column] : 0;
+    }
+
+    int rowEntries(int row) const override
+    {
+        return row < mRowCount ? mRowPtr[row+1] - mRowPtr[row] : 0;
+    }
+
+    int maxSymbolDimension(Qt::Orientation orientation) const override
+    {
+        return orientation == Qt::Horizontal ? mVarDimension : mEqnDimension;
+    }
+
+private:
+    bool isAbsolute() const
+    {
+        return mViewConfig->currentAggregation().useAbsoluteValues() ||
+               mViewConfig->currentValueFilter().isAbsolute();
+    }
+
+    int find(int row, int column) const
+    {
+        if (row < 0 || row >= mRowCount)
+            return -1;
+        auto first = mColumns.constBegin() + mRowPtr[row];
+        auto last = mColumns.constBegin() + mRowPtr[row+1];
+        auto iter = std::lower_bound(first, last, column);
+        return iter != last && *iter == column ? int(iter - mColumns.constBegin()) : -1;
+    }
+
+    ///
+    /// \brief Unites the sections of the visible symbols of <c>orientation</c>.
+    /// \return The aggregated logical index of each Jacobian section or -1 if
+    ///         the section is hidden.
+    /// \remark The first section of each united group is used as header.
+    ///
+    QVector<int> uniteSections(Qt::Orientation orientation, int sectionCount, int &dimension)
+    {
+        QVector<int> sectionMap(sectionCount, -1);
+        auto& mapping = mLogicalSectionMapping[orientation];
+        const auto aggregationSymbols = mViewConfig->currentAggregation().aggregationSymbols(orientation);
+        for (const auto &filter : std::as_const(mViewConfig->currentIdentifierFilter()[orientation])) {
+            if (filter.Checked == Qt::Unchecked)
+                continue;
+            auto symbol = orientation == Qt::Vertical ? mModelInstance.equation(filter.SymbolIndex)
+                                                      : mModelInstance.variable(filter.SymbolIndex);
+            if (!symbol)
+                continue;
+            dimension = std::max(dimension, symbol->dimension());
+            QVector<int> keptDimensions;
+            auto item = aggregationSymbols.constFind(filter.SymbolIndex);
+            for (int d=0; d<symbol->dimension(); ++d) {
+                if (item == aggregationSymbols.constEnd() || !item->isChecked(d+1))
+                    keptDimensions.append(d);
+            }
+            if (keptDimensions.size() == symbol->dimension()) {
+                for (int s=symbol->firstSection(); s<=symbol->lastSection(); ++s) {
+                    if (s < sectionCount)
+                        sectionMap[s] = mapping.size();
+                    mapping.append(s);
                 }
-                if (!sym_nz) continue;
-                SymbolRow* row = &mRows[rr];
-                row->setEntries(end_c + 1 - start_c);
-                row->setData(new double[row->entries()]);
-                row->setNlFlags(new int[row->entries()]);
-                row->setFirstIdx(start_c - variables.first()->firstSection());
-                if (sym_nz == row->entries()) {
-                    for (int nz=start_i, c=0; nz<start_i+sym_nz; ++nz, ++c) {
-                        row->data()[c] = data[nz];
-                        row->nlFlags()[c] = sparseRow->nlFlags()[nz];
-                        mDataMinimum = std::min(mDataMinimum, row->data()[c]);
-                        mDataMaximum = std::max(mDataMaximum, row->data()[c]);
-                        ++mColumnEntryCount[row->firstIdx()+c];
-                    }
-                } else {
-                    std::fill(row->data(), row->data()+row->entries(), 0.0);
-                    std::fill(row->nlFlags(), row->nlFlags()+row->entries(), 0);
-                    for (int nz=start_i, c=0; nz<start_i+sym_nz; ++nz) {
-                        c = sparseRow->colIdx()[nz] - start_c;
-                        row->data()[c] = data[nz];
-                        row->nlFlags()[c] = sparseRow->nlFlags()[nz];
-                        mDataMinimum = std::min(mDataMinimum, row->data()[c]);
-                        mDataMaximum = std::max(mDataMaximum, row->data()[c]);
-                        ++mColumnEntryCount[row->firstIdx()+c];
+                continue;
+            }
+            QHash<QVector<int>, int> groups;
+            QVector<int> key(keptDimensions.size());
+            for (int s=symbol->firstSection(); s<=symbol->lastSection() && s<sectionCount; ++s) {
+                for (int k=0; k<keptDimensions.size(); ++k) {
+                    key[k] = symbol->labelIndex(s, keptDimensions[k]);
+                }
+                auto group = groups.constFind(key);
+                if (group == groups.constEnd()) {
+                    group = groups.insert(key, mapping.size());
+                    mapping.append(s);
+                }
+                sectionMap[s] = *group;
+            }
+        }
+        return sectionMap;
+    }
+
+    void reduce(const QVector<int> &rowMap, const QVector<int> &columnMap)
+    {
+        auto type = mViewConfig->currentAggregation().type();
+
+        // Jacobian rows of each aggregated row
+        QVector<int> groupPtr(mRowCount+1, 0);
+        for (int r=0; r<rowMap.size(); ++r) {
+            if (rowMap[r] >= 0)
+                ++groupPtr[rowMap[r]+1];
+        }
+        for (int R=0; R<mRowCount; ++R) {
+            groupPtr[R+1] += groupPtr[R];
+        }
+        QVector<int> groupRows(groupPtr[mRowCount]);
+        QVector<int> groupFill(groupPtr.constBegin(), groupPtr.constEnd()-1);
+        for (int r=0; r<rowMap.size(); ++r) {
+            if (rowMap[r] >= 0)
+                groupRows[groupFill[rowMap[r]]++] = r;
+        }
+
+        mRowPtr.fill(0, mRowCount+1);
+        mColumns.clear();
+        mValues.clear();
+        mNlFlags.clear();
+        mColumnEntryCount.fill(0, mColumnCount);
+        QVector<int> cellCount(mColumnCount, 0);
+        QVector<double> cellValue(mColumnCount, 0.0);
+        QVector<bool> cellNl(mColumnCount, false);
+        QVector<int> cellOffset;
+        QVector<double> values;
+        if (type == Aggregation::Median)
+            cellOffset.resize(mColumnCount);
+        QVector<int> touched;
+        for (int R=0; R<mRowCount; ++R) {
+            touched.clear();
+            for (int g=groupPtr[R]; g<groupPtr[R+1]; ++g) {
+                auto sparseRow = dataRow(groupRows[g]);
+                auto data = mModelInstance.useOutput() ? sparseRow.outputData() : sparseRow.inputData();
+                const int* colIdx = sparseRow.colIdx();
+                for (int i=0; i<sparseRow.entries(); ++i) {
+                    int C = columnMap[colIdx[i]];
+                    if (C < 0)
+                        continue;
+                    double value = mAbsolute ? std::abs(data[i]) : data[i];
+                    if (!cellCount[C]++) {
+                        touched.append(C);
+                        cellValue[C] = value;
+                    } else if (type == Aggregation::Sum || type == Aggregation::Mean) {
+                        cellValue[C] += value;
+                    } else if (type == Aggregation::Minimum) {
+                        cellValue[C] = std::min(cellValue[C], value);
+                    } else if (type == Aggregation::Maximum) {
+                        cellValue[C] = std::max(cellValue[C], value);
                     }
+                    if (sparseRow.nlFlag(i))
+                        cellNl[C] = true;
                 }
             }
+            std::sort(touched.begin(), touched.end());
+            if (type == Aggregation::Median)
+                collectValues(groupPtr[R], groupPtr[R+1], groupRows, columnMap,
+                              touched, cellCount, cellOffset, values, mAbsolute);
+            for (int C : std::as_const(touched)) {
+                double value = cellValue[C];
+                if (type == Aggregation::Count) {
+                    value = cellCount[C];
+                } else if (type == Aggregation::Mean) {
+                    value /= cellCount[C];
+                } else if (type == Aggregation::Median) {
+                    value = Aggregation::median(values.data()+cellOffset[C]-cellCount[C], cellCount[C]);
+                }
+                int entry = mColumns.size();
+                if (entry % NlFlags::WordBits == 0)
+                    mNlFlags.append(NlFlags::Word(0));
+                if (cellNl[C])
+                    NlFlags::set(mNlFlags.data(), entry);
+                mColumns.append(C);
+                mValues.append(value);
+                mDataMinimum = std::min(mDataMinimum, value);
+                mDataMaximum = std::max(mDataMaximum, value);
+                ++mColumnEntryCount[C];
+                cellCount[C] = 0;
+                cellNl[C] = false;
+            }
+            mRowPtr[R+1] = mColumns.size();
         }
         mViewConfig->defaultValueFilter().MinValue = mDataMinimum;
         mViewConfig->defaultValueFilter().MaxValue = mDataMaximum;
@@ -909,11 +1255,47 @@ private:
         mViewConfig->currentValueFilter().MaxValue = mDataMaximum;
     }
 
+    ///
+    /// \brief Collects the values of one aggregated row grouped by cell, i.e.
+    ///        the values of cell C end at <c>cellOffset[C]</c>.
+    ///
+    void collectValues(int firstGroupRow, int lastGroupRow, const QVector<int> &groupRows,
+                       const QVector<int> &columnMap, const QVector<int> &touched,
+                       const QVector<int> &cellCount, QVector<int> &cellOffset,
+                       QVector<double> &values, bool absolute)
+    {
+        int offset = 0;
+        for (int C : touched) {
+            cellOffset[C] = offset;
+            offset += cellCount[C];
+        }
+        values.resize(offset);
+        for (int g=firstGroupRow; g<lastGroupRow; ++g) {
+            auto sparseRow = dataRow(groupRows[g]);
+            auto data = mModelInstance.useOutput() ? sparseRow.outputData() : sparseRow.inputData();
+            const int* colIdx = sparseRow.colIdx();
+            for (int i=0; i<sparseRow.entries(); ++i) {
+                int C = columnMap[colIdx[i]];
+                if (C < 0)
+                    continue;
+                values[cellOffset[C]++] = absolute ? std::abs(data[i]) : data[i];
+            }
+        }
+    }
+
 private:
-    SymbolRow* mRows = nullptr;
-    int* mColumnEntryCount = nullptr;
+    // aggregated cells in row storage (CSR)
+    QVector<int> mRowPtr;
+    QVector<int> mColumns;
+    QVector<double> mValues;
+    QVector<NlFlags::Word> mNlFlags;
+    QVector<int> mColumnEntryCount;
+    // aggregated logical index of each Jacobian row and column
+    QVector<int> mRowMap;
+    QVector<int> mColumnMap;
     int mEqnDimension = 0;
     int mVarDimension = 0;
+    bool mAbsolute = false;
 };
 
 class BPOverviewDataProvider final : public DataHandler::AbstractDataProvider
@@ -922,105 +1304,33 @@ public:
     BPOverviewDataProvider(DataHandler *dataHandler,
                            AbstractModelInstance& modelInstance,
                            const QSharedPointer<AbstractViewConfiguration> &viewConfig,
-                           const QSharedPointer<DataHandler::CoefficientInfo> &negPosCount)
+                           const QSharedPointer<const DataHandler::CoefficientInfo> &coeffInfo)
         : DataHandler::AbstractDataProvider(dataHandler, modelInstance, viewConfig)
-        , mCoeffCount(negPosCount)
+        , mCoeffInfo(coeffInfo)
     {
         mSymbolRowCount = mModelInstance.equationCount();
         mRowCount = mSymbolRowCount + 1;
         mSymbolColumnCount = mModelInstance.variableCount();
         mColumnCount = mSymbolColumnCount + 2;
-        mDataMatrix = new char*[mRowCount];
-        for (int r=0; r<mRowCount; ++r) {
-            mDataMatrix[r] = new char[mColumnCount];
-            std::fill(mDataMatrix[r], mDataMatrix[r]+mColumnCount, 0);
-        }
-        mNlFlags = new int*[mRowCount];
-        for (int r=0, rr=0; r<mRowCount; ++r, rr+=2) {
-            mNlFlags[r] = new int[mColumnCount];
-            std::fill(mNlFlags[r], mNlFlags[r]+mColumnCount, 0);
-            if (rr+1 >= mCoeffCount->rowCount())
-                continue;
-            for (int c=0; c<mSymbolColumnCount; ++c) {
-                if (c < mCoeffCount->columnCount()) {
-                    mNlFlags[r][c] += mCoeffCount->nlFlags()[rr][c] + mCoeffCount->nlFlags()[rr+1][c];
-                }
-            }
-        }
+        mMargins = BlockPatternMargins<char>(mSymbolRowCount, mSymbolColumnCount,
+                                             mRowCount, mColumnCount);
     }
 
-    BPOverviewDataProvider(const BPOverviewDataProvider& other)
-        : DataHandler::AbstractDataProvider(other)
-        , mCoeffCount(other.mCoeffCount)
-    {
-        mDataMatrix = new char*[mRowCount];
-        for (int r=0; r<mRowCount; ++r) {
-            mDataMatrix[r] = new char[mColumnCount];
-            std::copy(other.mDataMatrix[r], other.mDataMatrix[r]+other.mColumnCount, mDataMatrix[r]);
-        }
-        mNlFlags = new int*[mRowCount];
-        for (int r=0; r<mRowCount; ++r) {
-            mNlFlags[r] = new int[mColumnCount];
-            std::copy(other.mNlFlags[r], other.mNlFlags[r]+other.mColumnCount, mNlFlags[r]);
-        }
-    }
-
-    BPOverviewDataProvider(BPOverviewDataProvider&& other) noexcept
-        : DataHandler::AbstractDataProvider(std::move(other))
-        , mDataMatrix(other.mDataMatrix)
-        , mCoeffCount(std::move(other.mCoeffCount))
-        , mNlFlags(other.mNlFlags)
-    {
-        other.mDataMatrix = nullptr;
-        other.mNlFlags = nullptr;
-    }
-
-    ~BPOverviewDataProvider()
-    {
-        for (int r=0; r<mRowCount; ++r) {
-            delete [] mDataMatrix[r];
-        }
-        if (mDataMatrix) delete [] mDataMatrix;
-        for (int r=0; r<mRowCount; ++r) {
-            delete [] mNlFlags[r];
-        }
-        if (mNlFlags) delete [] mNlFlags;
-    }
+    BPOverviewDataProvider(const BPOverviewDataProvider& other) = default;
 
     void loadData() override
     {
-        int negRow = 1, posRow = 0;
+        auto cells = mMargins.cells();
         for (const auto& equations : mModelInstance.equations()) {
             mLogicalSectionMapping[Qt::Vertical].append(equations->firstSection());
         }
         for (const auto& variable : mModelInstance.variables()) {
             mLogicalSectionMapping[Qt::Horizontal].append(variable->firstSection());
         }
-        for (int r=0; r<mModelInstance.equationCount(); ++r, negRow += 2, posRow += 2) {
-            for (int c=0; c<mColumnCount-2; ++c) {
-                if (mCoeffCount->count()[negRow][c] == 0 && mCoeffCount->count()[posRow][c] == 0) {
-                    mDataMatrix[r][c] = 0x0;
-                } else if (mCoeffCount->count()[negRow][c] == 0 && mCoeffCount->count()[posRow][c] > 0) {
-                    mDataMatrix[r][c] = ValueHelper::Plus;
-                } else if (mCoeffCount->count()[negRow][c] < 0 && mCoeffCount->count()[posRow][c] == 0) {
-                    mDataMatrix[r][c] = ValueHelper::Minus;
-                } else {
-                    mDataMatrix[r][c] = ValueHelper::Mixed;
-                }
-            }
-            mDataMatrix[r][mColumnCount-2] = mCoeffCount->count()[posRow][mCoeffCount->columnCount()-2];
-            if (mCoeffCount->count()[negRow][mColumnCount-1] == 0 &&
-                mCoeffCount->count()[posRow][mColumnCount-1] == 0) {
-                mDataMatrix[r][mColumnCount-1] = '0';
-            } else if (mCoeffCount->count()[negRow][mColumnCount-1] == 0 &&
-                       mCoeffCount->count()[posRow][mColumnCount-1] > 0) {
-                mDataMatrix[r][mColumnCount-1] = ValueHelper::Plus;
-            } else if (mCoeffCount->count()[negRow][mColumnCount-1] < 0 &&
-                       mCoeffCount->count()[posRow][mColumnCount-1] == 0) {
-                mDataMatrix[r][mColumnCount-1] = ValueHelper::Minus;
-            } else {
-                mDataMatrix[r][mColumnCount-1] = ValueHelper::Mixed;
-            }
+        for (int r=0; r<mModelInstance.equationCount(); ++r) {
+            cells(r, mColumnCount-2) = mCoeffInfo->equationType(r);
+            cells(r, mColumnCount-1) = sign(mCoeffInfo->negativeRhs(r),
+                                                    mCoeffInfo->positiveRhs(r), '0');
         }
         int varColumn = 0;
         auto columns = mModelInstance.variableRowCount();
@@ -1037,14 +1347,14 @@ public:
             }
             if (mModelInstance.variableType(variable->firstSection()) == 'x') { // x = continuous
                 if (lower >= 0 && upper >= 0) {
-                    mDataMatrix[mRowCount-1][varColumn] = ValueHelper::Plus;
+                    cells(mRowCount-1, varColumn) = ValueHelper::Plus;
                 } else if (lower <= 0 && upper <= 0) {
-                    mDataMatrix[mRowCount-1][varColumn] = ValueHelper::Minus;
+                    cells(mRowCount-1, varColumn) = ValueHelper::Minus;
                 } else {
-                    mDataMatrix[mRowCount-1][varColumn] = 'u';
+                    cells(mRowCount-1, varColumn) = 'u';
                 }
             } else {
-                mDataMatrix[mRowCount-1][varColumn] = mModelInstance.variableType(variable->firstSection());
+                cells(mRowCount-1, varColumn) = mModelInstance.variableType(variable->firstSection());
             }
             ++varColumn;
         }
@@ -1052,54 +1362,49 @@ public:
         delete [] upperBounds;
     }
 
-    double data(int row, int column) const override
+    bool updateValueFilter() override
     {
-        return mDataMatrix[row][column];
+        // the signs and types don't depend on the value filter
+        return true;
     }
 
-    int nlFlag(int row, int column) const override
+    double data(int row, int column) const override
     {
-        return mNlFlags[row][column];
+        if (mMargins.isBlock(row, column)) {
+            int block = mCoeffInfo->block(row, column);
+            if (block < 0)
+                return 0x0;
+            return sign(mCoeffInfo->negativeCount(block), mCoeffInfo->positiveCount(block), 0x0);
+        }
+        return mMargins.value(row, column);
     }
 
-    auto& operator=(const BPOverviewDataProvider& other)
-    {
-        for (int r=0; r<mRowCount; ++r) {
-            delete [] mDataMatrix[r];
-        }
-        delete [] mDataMatrix;
-        mDataMatrix = new char*[mRowCount];
-        for (int r=0; r<mRowCount; ++r) {
-            mDataMatrix[r] = new char[mColumnCount];
-            std::copy(other.mDataMatrix[r], other.mDataMatrix[r]+other.mColumnCount, mDataMatrix[r]);
-        }
-        mCoeffCount = other.mCoeffCount;
-        for (int r=0; r<mRowCount; ++r) {
-            delete [] mNlFlags[r];
-        }
-        delete [] mNlFlags;
-        mNlFlags = new int*[mRowCount];
-        for (int r=0; r<mRowCount; ++r) {
-            mNlFlags[r] = new int[mColumnCount];
-            std::copy(other.mNlFlags[r], other.mNlFlags[r]+other.mColumnCount, mNlFlags[r]);
-        }
-        return *this;
+    int nlFlag(int row, int column) const override
+    {
+        if (mMargins.isBlock(row, column))
+            return mCoeffInfo->nlFlag(row, column);
+        return mMargins.nlFlag(row, column);
     }
 
-    auto& operator=(BPOverviewDataProvider&& other) noexcept
+private:
+    ///
+    /// \brief Sign symbol of a cell with <c>negative</c> negative and
+    ///        <c>positive</c> positive values, or <c>empty</c> if it has none.
+    ///
+    static char sign(int negative, int positive, char empty)
     {
-        mDataMatrix = other.mDataMatrix;
-        other.mDataMatrix = nullptr;
-        mCoeffCount = std::move(other.mCoeffCount);
-        mNlFlags = other.mNlFlags;
-        other.mNlFlags = nullptr;
-        return *this;
+        if (!negative && !positive)
+            return empty;
+        if (!negative)
+            return ValueHelper::Plus;
+        if (!positive)
+            return ValueHelper::Minus;
+        return ValueHelper::Mixed;
     }
 
 private:
-    char** mDataMatrix;
-    QSharedPointer<DataHandler::CoefficientInfo> mCoeffCount;
-    int** mNlFlags = nullptr;
+    QSharedPointer<const DataHandler::CoefficientInfo> mCoeffInfo;
+    BlockPatternMargins<char> mMargins;
 };
 
 class BPCountDataProvider final : public DataHandler::AbstractDataProvider
@@ -1108,7 +1413,7 @@ public:
     BPCountDataProvider(DataHandler *dataHandler,
                         AbstractModelInstance& modelInstance,
                         const QSharedPointer<AbstractViewConfiguration> &viewConfig,
-                        const QSharedPointer<DataHandler::CoefficientInfo> &coeffInfo)
+                        const QSharedPointer<const DataHandler::CoefficientInfo> &coeffInfo)
         : DataHandler::AbstractDataProvider(dataHandler, modelInstance, viewConfig)
         , mCoeffInfo(coeffInfo)
     {
@@ -1118,72 +1423,15 @@ public:
         mRowCount = mSymbolRowCount + 4;
         mSymbolColumnCount = mModelInstance.variableCount();
         mColumnCount = mSymbolColumnCount + 4;
-        mDataMatrix = new int*[mRowCount];
-        for (int r=0; r<mRowCount; ++r) {
-            mDataMatrix[r] = new int[mColumnCount];
-
-            for (int c=0; r<mCoeffInfo->rowCount() && c<mCoeffInfo->columnCount(); ++c) {
-                mDataMatrix[r][c] = mCoeffInfo->count()[r][c];
-                if (c != mColumnCount-4) {
-                    mDataMinimum = std::min(mDataMinimum, double(mDataMatrix[r][c]));
-                    mDataMaximum = std::max(mDataMaximum, double(mDataMatrix[r][c]));
-                }
-            }
-            if (r < mCoeffInfo->rowCount())
-                std::fill(mDataMatrix[r]+mCoeffInfo->columnCount(), mDataMatrix[r]+mColumnCount, 0);
-            else
-                std::fill(mDataMatrix[r], mDataMatrix[r]+mColumnCount, 0);
-        }
-        mNlFlags = new int*[mRowCount];
-        for (int r=0; r<mRowCount; ++r) {
-            mNlFlags[r] = new int[mColumnCount];
-            std::fill(mNlFlags[r], mNlFlags[r]+mColumnCount, 0);
-            if (r >= mCoeffInfo->rowCount())
-                continue;
-            std::copy(mCoeffInfo->nlFlags()[r], mCoeffInfo->nlFlags()[r]+mCoeffInfo->columnCount(), mNlFlags[r]);
-        }
-    }
-
-    BPCountDataProvider(const BPCountDataProvider& other)
-        : DataHandler::AbstractDataProvider(other)
-        , mCoeffInfo(other.mCoeffInfo)
-    {
-        mDataMatrix = new int*[mRowCount];
-        for (int r=0; r<mRowCount; ++r) {
-            mDataMatrix[r] = new int[mColumnCount];
-            std::copy(other.mDataMatrix[r], other.mDataMatrix[r]+other.mColumnCount, mDataMatrix[r]);
-        }
-        mNlFlags = new int*[mRowCount];
-        for (int r=0; r<mRowCount; ++r) {
-            mNlFlags[r] = new int[mColumnCount];
-            std::copy(other.mNlFlags[r], other.mNlFlags[r]+other.mColumnCount, mNlFlags[r]);
-        }
-    }
-
-    BPCountDataProvider(BPCountDataProvider&& other) noexcept
-        : DataHandler::AbstractDataProvider(std::move(other))
-        , mDataMatrix(other.mDataMatrix)
-        , mCoeffInfo(std::move(other.mCoeffInfo))
-        , mNlFlags(other.mNlFlags)
-    {
-        other.mDataMatrix = nullptr;
-        other.mNlFlags = nullptr;
+        mMargins = BlockPatternMargins<int>(mSymbolRowCount, mSymbolColumnCount,
+                                            mRowCount, mColumnCount);
     }
 
-    ~BPCountDataProvider()
-    {
-        for (int r=0; r<mRowCount; ++r) {
-            delete [] mDataMatrix[r];
-        }
-        delete [] mDataMatrix;
-        for (int r=0; r<mRowCount; ++r) {
-            delete [] mNlFlags[r];
-        }
-        delete [] mNlFlags;
-    }
+    BPCountDataProvider(const BPCountDataProvider& other) = default;
 
     void loadData() override
     {
+        auto cells = mMargins.cells();
         for (const auto& equation : mModelInstance.equations()) {
             mLogicalSectionMapping[Qt::Vertical].append(equation->firstSection());
             mLogicalSectionMapping[Qt::Vertical].append(equation->firstSection());
@@ -1192,45 +1440,67 @@ public:
             mLogicalSectionMapping[Qt::Horizontal].append(variable->firstSection());
         }
         for (int r=0, negRow = 1, posRow = 0; r<mModelInstance.equationCount(); ++r, negRow += 2, posRow += 2) {
-            for (int v=0; v<mModelInstance.variableCount(); ++v) {
-                mDataMatrix[negRow][mColumnCount-2] += mDataMatrix[negRow][v];
-                mDataMatrix[posRow][mColumnCount-2] += mDataMatrix[posRow][v];
-                mDataMatrix[mRowCount-3][v] += mDataMatrix[negRow][v];
-                mDataMatrix[mRowCount-4][v] += mDataMatrix[posRow][v];
-                mNlFlags[posRow][mColumnCount-2] += mNlFlags[posRow][v];
-                mNlFlags[negRow][mColumnCount-2] += mNlFlags[negRow][v];
-                mNlFlags[mRowCount-4][v] += mNlFlags[posRow][v];
-                mNlFlags[mRowCount-3][v] += mNlFlags[negRow][v];
-                mNlFlags[mRowCount-4][mColumnCount-2] += mNlFlags[posRow][v];
-                mNlFlags[mRowCount-3][mColumnCount-2] += mNlFlags[negRow][v];
+            // the empty blocks keep the zero count
+            if (mCoeffInfo->blockCount(r) < mSymbolColumnCount) {
+                mDataMinimum = std::min(mDataMinimum, 0.0);
+                mDataMaximum = std::max(mDataMaximum, 0.0);
+            }
+            int negCount = 0, posCount = 0;
+            bool nlFlag = false;
+            const int* blocks = mCoeffInfo->blockColumns(r);
+            for (int b=0; b<mCoeffInfo->blockCount(r); ++b) {
+                int v = blocks[b];
+                int block = mCoeffInfo->firstBlock(r) + b;
+                int neg = mCoeffInfo->negativeCount(block);
+                int pos = mCoeffInfo->positiveCount(block);
+                mDataMinimum = std::min(mDataMinimum, double(std::min(neg, pos)));
+                mDataMaximum = std::max(mDataMaximum, double(std::max(neg, pos)));
+                negCount += neg;
+                posCount += pos;
+                cells(mRowCount-3, v) += neg;
+                cells(mRowCount-4, v) += pos;
+                nlFlag = nlFlag || mCoeffInfo->nlFlag(block);
+                cells.uniteNlFlag(mRowCount-4, v, mCoeffInfo->nlFlag(block));
+                cells.uniteNlFlag(mRowCount-3, v, mCoeffInfo->nlFlag(block));
             }
-            mDataMinimum = std::min(mDataMinimum, double(mDataMatrix[negRow][mColumnCount-2]));
-            mDataMaximum = std::max(mDataMaximum, double(mDataMatrix[negRow][mColumnCount-2]));
-            mDataMinimum = std::min(mDataMinimum, double(mDataMatrix[posRow][mColumnCount-2]));
-            mDataMaximum = std::max(mDataMaximum, double(mDataMatrix[posRow][mColumnCount-2]));
-            mDataMatrix[mRowCount-3][mColumnCount-3] += mDataMatrix[negRow][mColumnCount-3];
-            mDataMatrix[mRowCount-4][mColumnCount-3] += mDataMatrix[posRow][mColumnCount-3];
-            mDataMatrix[mRowCount-3][mColumnCount-2] += mDataMatrix[negRow][mColumnCount-2];
-            mDataMatrix[mRowCount-4][mColumnCount-2] += mDataMatrix[posRow][mColumnCount-2];
+            cells(posRow, mColumnCount-4) = mCoeffInfo->equationType(r);
+            cells(negRow, mColumnCount-3) = mCoeffInfo->negativeRhs(r);
+            cells(posRow, mColumnCount-3) = mCoeffInfo->positiveRhs(r);
+            cells(negRow, mColumnCount-2) = negCount;
+            cells(posRow, mColumnCount-2) = posCount;
+            cells.uniteNlFlag(posRow, mColumnCount-2, nlFlag);
+            cells.uniteNlFlag(negRow, mColumnCount-2, nlFlag);
+            cells.uniteNlFlag(mRowCount-4, mColumnCount-2, nlFlag);
+            cells.uniteNlFlag(mRowCount-3, mColumnCount-2, nlFlag);
+            for (int c=mColumnCount-3; c<mColumnCount-1; ++c) {
+                mDataMinimum = std::min(mDataMinimum, double(cells(negRow, c)));
+                mDataMaximum = std::max(mDataMaximum, double(cells(negRow, c)));
+                mDataMinimum = std::min(mDataMinimum, double(cells(posRow, c)));
+                mDataMaximum = std::max(mDataMaximum, double(cells(posRow, c)));
+            }
+            cells(mRowCount-3, mColumnCount-3) += mCoeffInfo->negativeRhs(r);
+            cells(mRowCount-4, mColumnCount-3) += mCoeffInfo->positiveRhs(r);
+            cells(mRowCount-3, mColumnCount-2) += negCount;
+            cells(mRowCount-4, mColumnCount-2) += posCount;
         }
         for (int r=mRowCount-4; r<mRowCount-1; ++r) {
             for (int c=0; c<mColumnCount; ++c) {
-                mDataMinimum = std::min(mDataMinimum, double(mDataMatrix[r][c]));
-                mDataMaximum = std::max(mDataMaximum, double(mDataMatrix[r][c]));
+                mDataMinimum = std::min(mDataMinimum, double(cells(r, c)));
+                mDataMaximum = std::max(mDataMaximum, double(cells(r, c)));
             }
         }
         int index = 0;
         for (const auto& equation : mModelInstance.equations()) {
-            mDataMatrix[index][mColumnCount-1] = equation->entries();
-            mDataMinimum = std::min(mDataMinimum, double(mDataMatrix[index][mColumnCount-1]));
-            mDataMaximum = std::max(mDataMaximum, double(mDataMatrix[index][mColumnCount-1]));
+            cells(index, mColumnCount-1) = equation->entries();
+            mDataMinimum = std::min(mDataMinimum, double(cells(index, mColumnCount-1)));
+            mDataMaximum = std::max(mDataMaximum, double(cells(index, mColumnCount-1)));
             index += 2;
         }
         index = 0;
         for (const auto& variable : mModelInstance.variables()) {
-            mDataMatrix[mRowCount-2][index] = variable->entries();
-            mDataMinimum = std::min(mDataMinimum, double(mDataMatrix[mRowCount-2][index]));
-            mDataMaximum = std::max(mDataMaximum, double(mDataMatrix[mRowCount-2][index]));
+            cells(mRowCount-2, index) = variable->entries();
+            mDataMinimum = std::min(mDataMinimum, double(cells(mRowCount-2, index)));
+            mDataMaximum = std::max(mDataMaximum, double(cells(mRowCount-2, index)));
             ++index;
         }
         int varColumn = 0;
@@ -1248,14 +1518,14 @@ public:
             }
             if (mModelInstance.variableType(variable->firstSection()) == 'x') { // x = continuous
                 if (lower >= 0 && upper >= 0) {
-                    mDataMatrix[mRowCount-1][varColumn] = ValueHelper::Plus;
+                    cells(mRowCount-1, varColumn) = ValueHelper::Plus;
                 } else if (lower <= 0 && upper <= 0) {
-                    mDataMatrix[mRowCount-1][varColumn] = ValueHelper::Minus;
+                    cells(mRowCount-1, varColumn) = ValueHelper::Minus;
                 } else {
-                    mDataMatrix[mRowCount-1][varColumn] = 'u';
+                    cells(mRowCount-1, varColumn) = 'u';
                 }
             } else {
-                mDataMatrix[mRowCount-1][varColumn] = mModelInstance.variableType(variable->firstSection());
+                cells(mRowCount-1, varColumn) = mModelInstance.variableType(variable->firstSection());
             }
             ++varColumn;
         }
@@ -1269,52 +1539,25 @@ public:
 
     double data(int row, int column) const override
     {
-        return std::abs(mDataMatrix[row][column]);
-    }
-
-    int nlFlag(int row, int column) const override
-    {
-        return mNlFlags[row][column];
-    }
-
-    auto& operator=(const BPCountDataProvider& other)
-    {
-        for (int r=0; r<mRowCount; ++r) {
-            delete [] mDataMatrix[r];
+        if (mMargins.isBlock(row, column)) {
+            int block = mCoeffInfo->block(row/2, column);
+            if (block < 0)
+                return 0.0;
+            return row % 2 ? mCoeffInfo->negativeCount(block) : mCoeffInfo->positiveCount(block);
         }
-        delete [] mDataMatrix;
-        mDataMatrix = new int*[mRowCount];
-        for (int r=0; r<mRowCount; ++r) {
-            mDataMatrix[r] = new int[mColumnCount];
-            std::copy(other.mDataMatrix[r], other.mDataMatrix[r]+other.mColumnCount, mDataMatrix[r]);
-        }
-        mCoeffInfo = other.mCoeffInfo;
-        for (int r=0; r<mRowCount; ++r) {
-            delete [] mNlFlags[r];
-        }
-        if (mNlFlags) delete [] mNlFlags;
-        mNlFlags = new int*[mRowCount];
-        for (int r=0; r<mRowCount; ++r) {
-            mNlFlags[r] = new int[mColumnCount];
-            std::copy(other.mNlFlags[r], other.mNlFlags[r]+other.mColumnCount, mNlFlags[r]);
-        }
-        return *this;
+        return std::abs(mMargins.value(row, column));
     }
 
-    auto& operator=(BPCountDataProvider&& other) noexcept
+    int nlFlag(int row, int column) const override
     {
-        mDataMatrix = other.mDataMatrix;
-        other.mDataMatrix = nullptr;
-        mCoeffInfo = std::move(other.mCoeffInfo);
-        mNlFlags = other.mNlFlags;
-        other.mNlFlags = nullptr;
-        return *this;
+        if (mMargins.isBlock(row, column))
+            return mCoeffInfo->nlFlag(row/2, column);
+        return mMargins.nlFlag(row, column);
     }
 
 private:
-    int** mDataMatrix;
-    QSharedPointer<DataHandler::CoefficientInfo> mCoeffInfo;
-    int** mNlFlags = nullptr;
+    QSharedPointer<const DataHandler::CoefficientInfo> mCoeffInfo;
+    BlockPatternMargins<int> mMargins;
 };
 
 class BPAverageDataProvider final : public DataHandler::AbstractDataProvider
@@ -1323,7 +1566,7 @@ public:
     BPAverageDataProvider(DataHandler *dataHandler,
                           AbstractModelInstance& modelInstance,
                           const QSharedPointer<AbstractViewConfiguration> &viewConfig,
-                          const QSharedPointer<DataHandler::CoefficientInfo> &coeffInfo)
+                          const QSharedPointer<const DataHandler::CoefficientInfo> &coeffInfo)
         : DataHandler::AbstractDataProvider(dataHandler, modelInstance, viewConfig)
         , mCoeffInfo(coeffInfo)
     {
@@ -1333,61 +1576,15 @@ public:
         mRowCount = mSymbolRowCount + 4;
         mSymbolColumnCount = mModelInstance.variableCount();
         mColumnCount = mSymbolColumnCount + 4;
-        mDataMatrix = new double*[mRowCount];
-        for (int r=0; r<mRowCount; ++r) {
-            mDataMatrix[r] = new double[mColumnCount];
-            std::fill(mDataMatrix[r], mDataMatrix[r]+mColumnCount, 0);
-        }
-        mNlFlags = new int*[mRowCount];
-        for (int r=0; r<mRowCount; ++r) {
-            mNlFlags[r] = new int[mColumnCount];
-            std::fill(mNlFlags[r], mNlFlags[r]+mColumnCount, 0);
-            if (r >= mCoeffInfo->rowCount())
-                continue;
-            std::copy(mCoeffInfo->nlFlags()[r], mCoeffInfo->nlFlags()[r]+mCoeffInfo->columnCount(), mNlFlags[r]);
-        }
-    }
-
-    BPAverageDataProvider(const BPAverageDataProvider& other)
-        : DataHandler::AbstractDataProvider(other)
-        , mCoeffInfo(other.mCoeffInfo)
-    {
-        mDataMatrix = new double*[mRowCount];
-        for (int r=0; r<mRowCount; ++r) {
-            mDataMatrix[r] = new double[mColumnCount];
-            std::copy(other.mDataMatrix[r], other.mDataMatrix[r]+other.mColumnCount, mDataMatrix[r]);
-        }
-        mNlFlags = new int*[mRowCount];
-        for (int r=0; r<mRowCount; ++r) {
-            mNlFlags[r] = new int[mColumnCount];
-            std::copy(other.mNlFlags[r], other.mNlFlags[r]+other.mColumnCount, mNlFlags[r]);
-        }
-    }
-
-    BPAverageDataProvider(BPAverageDataProvider&& other) noexcept
-        : DataHandler::AbstractDataProvider(std::move(other))
-        , mDataMatrix(other.mDataMatrix)
-        , mCoeffInfo(std::move(other.mCoeffInfo))
-        , mNlFlags(other.mNlFlags)
-    {
-        other.mDataMatrix = nullptr;
-        other.mNlFlags = nullptr;
+        mMargins = BlockPatternMargins<double>(mSymbolRowCount, mSymbolColumnCount,
+                                               mRowCount, mColumnCount);
     }
 
-    ~BPAverageDataProvider()
-    {
-        for (int r=0; r<mRowCount; ++r) {
-            delete [] mDataMatrix[r];
-        }
-        delete [] mDataMatrix;
-        for (int r=0; r<mRowCount; ++r) {
-            delete [] mNlFlags[r];
-        }
-        delete [] mNlFlags;
-    }
+    BPAverageDataProvider(const BPAverageDataProvider& other) = default;
 
     void loadData() override
     {
+        auto cells = mMargins.cells();
         for (const auto& equation : mModelInstance.equations()) {
             mLogicalSectionMapping[Qt::Vertical].append(equation->firstSection());
             mLogicalSectionMapping[Qt::Vertical].append(equation->firstSection());
@@ -1397,59 +1594,58 @@ public:
         }
         int index = 0;
         for (const auto& equation : mModelInstance.equations()) {
-            mDataMatrix[index][mColumnCount-1] = equation->entries();
-            mDataMinimum = std::min(mDataMinimum, double(mDataMatrix[index][mColumnCount-1]));
-            mDataMaximum = std::max(mDataMaximum, double(mDataMatrix[index][mColumnCount-1]));
+            cells(index, mColumnCount-1) = equation->entries();
+            mDataMinimum = std::min(mDataMinimum, cells(index, mColumnCount-1));
+            mDataMaximum = std::max(mDataMaximum, cells(index, mColumnCount-1));
             index += 2;
         }
         index = 0;
         for (const auto& variable : mModelInstance.variables()) {
-            mDataMatrix[mRowCount-2][index] = variable->entries();
-            mDataMinimum = std::min(mDataMinimum, double(mDataMatrix[mRowCount-2][index]));
-            mDataMaximum = std::max(mDataMaximum, double(mDataMatrix[mRowCount-2][index]));
+            cells(mRowCount-2, index) = variable->entries();
+            mDataMinimum = std::min(mDataMinimum, cells(mRowCount-2, index));
+            mDataMaximum = std::max(mDataMaximum, cells(mRowCount-2, index));
             ++index;
         }
         for (int r=0, negRow = 1, posRow = 0; r<mModelInstance.equationCount(); ++r, negRow += 2, posRow += 2) {
-            for (int c=0; c<mColumnCount-4; ++c) {
-                mDataMatrix[negRow][c] = mCoeffInfo->count()[negRow][c] / mDataMatrix[mRowCount-2][c];
-                mDataMatrix[negRow][mColumnCount-2] += mCoeffInfo->count()[negRow][c];
-                mDataMatrix[mRowCount-3][c] += mCoeffInfo->count()[negRow][c];
-                mDataMatrix[posRow][c] = mCoeffInfo->count()[posRow][c] / mDataMatrix[mRowCount-2][c];
-                mDataMatrix[posRow][mColumnCount-2] += mCoeffInfo->count()[posRow][c];
-                mDataMatrix[mRowCount-4][c] += mCoeffInfo->count()[posRow][c];
-                mDataMinimum = std::min(mDataMinimum, double(mDataMatrix[negRow][c]));
-                mDataMaximum = std::max(mDataMaximum, double(mDataMatrix[posRow][c]));
-                mDataMinimum = std::min(mDataMinimum, double(mDataMatrix[negRow][c]));
-                mDataMaximum = std::max(mDataMaximum, double(mDataMatrix[posRow][c]));
-                mNlFlags[posRow][mColumnCount-2] += mNlFlags[posRow][c];
-                mNlFlags[negRow][mColumnCount-2] += mNlFlags[negRow][c];
-                mNlFlags[mRowCount-4][c] += mNlFlags[posRow][c];
-                mNlFlags[mRowCount-3][c] += mNlFlags[negRow][c];
+            // the empty blocks keep the zero average
+            if (mCoeffInfo->blockCount(r) < mSymbolColumnCount) {
+                mDataMinimum = std::min(mDataMinimum, 0.0);
+                mDataMaximum = std::max(mDataMaximum, 0.0);
             }
-            for (int c=mCoeffInfo->columnCount()-2;
-                 posRow<mCoeffInfo->rowCount() && c<mCoeffInfo->columnCount(); ++c) {
-                mDataMatrix[posRow][c] = mCoeffInfo->count()[posRow][c];
-                if (c != mColumnCount-4) {
-                    mDataMinimum = std::min(mDataMinimum, double(mDataMatrix[posRow][c]));
-                    mDataMaximum = std::max(mDataMaximum, double(mDataMatrix[posRow][c]));
-                }
+            int negCount = 0, posCount = 0;
+            bool nlFlag = false;
+            const int* blocks = mCoeffInfo->blockColumns(r);
+            for (int b=0; b<mCoeffInfo->blockCount(r); ++b) {
+                int c = blocks[b];
+                int block = mCoeffInfo->firstBlock(r) + b;
+                negCount += mCoeffInfo->negativeCount(block);
+                posCount += mCoeffInfo->positiveCount(block);
+                cells(mRowCount-3, c) += mCoeffInfo->negativeCount(block);
+                cells(mRowCount-4, c) += mCoeffInfo->positiveCount(block);
+                mDataMinimum = std::min(mDataMinimum, average(mCoeffInfo->negativeCount(block), c));
+                mDataMaximum = std::max(mDataMaximum, average(mCoeffInfo->positiveCount(block), c));
+                nlFlag = nlFlag || mCoeffInfo->nlFlag(block);
+                cells.uniteNlFlag(mRowCount-4, c, mCoeffInfo->nlFlag(block));
+                cells.uniteNlFlag(mRowCount-3, c, mCoeffInfo->nlFlag(block));
+            }
+            cells.uniteNlFlag(posRow, mColumnCount-2, nlFlag);
+            cells.uniteNlFlag(negRow, mColumnCount-2, nlFlag);
+            cells(posRow, mColumnCount-4) = mCoeffInfo->equationType(r);
+            cells(posRow, mColumnCount-3) = mCoeffInfo->positiveRhs(r);
+            mDataMinimum = std::min(mDataMinimum, cells(posRow, mColumnCount-3));
+            mDataMaximum = std::max(mDataMaximum, cells(posRow, mColumnCount-3));
+            cells(negRow, mColumnCount-2) = negCount / cells(posRow, mColumnCount-1);
+            cells(posRow, mColumnCount-2) = posCount / cells(posRow, mColumnCount-1);
+            for (int row : { negRow, posRow }) {
+                mDataMinimum = std::min(mDataMinimum, cells(row, mColumnCount-2));
+                mDataMaximum = std::max(mDataMaximum, cells(row, mColumnCount-2));
             }
-            mDataMinimum = std::min(mDataMinimum, double(mDataMatrix[posRow][mColumnCount-1]));
-            mDataMaximum = std::max(mDataMaximum, double(mDataMatrix[posRow][mColumnCount-1]));
-            mDataMatrix[negRow][mColumnCount-2] /= mDataMatrix[posRow][mColumnCount-1];
-            mDataMinimum = std::min(mDataMinimum, double(mDataMatrix[negRow][mColumnCount-2]));
-            mDataMaximum = std::max(mDataMaximum, double(mDataMatrix[negRow][mColumnCount-2]));
-            mDataMatrix[posRow][mColumnCount-2] /= mDataMatrix[posRow][mColumnCount-1];
-            mDataMinimum = std::min(mDataMinimum, double(mDataMatrix[negRow][mColumnCount-2]));
-            mDataMaximum = std::max(mDataMaximum, double(mDataMatrix[negRow][mColumnCount-2]));
         }
         for (int c=0; c<mColumnCount-4; ++c) {
-            mDataMatrix[mRowCount-3][c] /= mDataMatrix[mRowCount-2][c];
-            mDataMatrix[mRowCount-4][c] /= mDataMatrix[mRowCount-2][c];
-            mDataMinimum = std::min(mDataMinimum, double(mDataMatrix[mRowCount-3][c]));
-            mDataMaximum = std::max(mDataMaximum, double(mDataMatrix[mRowCount-4][c]));
-            mDataMinimum = std::min(mDataMinimum, double(mDataMatrix[mRowCount-3][c]));
-            mDataMaximum = std::max(mDataMaximum, double(mDataMatrix[mRowCount-4][c]));
+            cells(mRowCount-3, c) /= cells(mRowCount-2, c);
+            cells(mRowCount-4, c) /= cells(mRowCount-2, c);
+            mDataMinimum = std::min(mDataMinimum, cells(mRowCount-3, c));
+            mDataMaximum = std::max(mDataMaximum, cells(mRowCount-4, c));
         }
         int varColumn = 0;
         auto columns = mModelInstance.variableRowCount();
@@ -1466,14 +1662,14 @@ public:
             }
             if (mModelInstance.variableType(variable->firstSection()) == 'x') { // x = continuous
                 if (lower >= 0 && upper >= 0) {
-                    mDataMatrix[mRowCount-1][varColumn] = '+';
+                    cells(mRowCount-1, varColumn) = '+';
                 } else if (lower <= 0 && upper <= 0) {
-                    mDataMatrix[mRowCount-1][varColumn] = '-';
+                    cells(mRowCount-1, varColumn) = '-';
                 } else {
-                    mDataMatrix[mRowCount-1][varColumn] = 'u';
+                    cells(mRowCount-1, varColumn) = 'u';
                 }
             } else {
-                mDataMatrix[mRowCount-1][varColumn] = mModelInstance.variableType(variable->firstSection());
+                cells(mRowCount-1, varColumn) = mModelInstance.variableType(variable->firstSection());
             }
             ++varColumn;
         }
@@ -1487,52 +1683,329 @@ public:
 
     double data(int row, int column) const override
     {
-        return std::abs(mDataMatrix[row][column]);
+        if (mMargins.isBlock(row, column)) {
+            int block = mCoeffInfo->block(row/2, column);
+            if (block < 0)
+                return 0.0;
+            return average(row % 2 ? mCoeffInfo->negativeCount(block)
+                                   : mCoeffInfo->positiveCount(block), column);
+        }
+        return std::abs(mMargins.value(row, column));
     }
 
     int nlFlag(int row, int column) const override
     {
-        return mNlFlags[row][column];
+        if (mMargins.isBlock(row, column))
+            return mCoeffInfo->nlFlag(row/2, column);
+        return mMargins.nlFlag(row, column);
+    }
+
+private:
+    ///
+    /// \brief Average of <c>count</c> over the entries of variable symbol
+    ///        <c>column</c>.
+    ///
+    double average(int count, int column) const
+    {
+        return count / mMargins.value(mRowCount-2, column);
+    }
+
+private:
+    QSharedPointer<const DataHandler::CoefficientInfo> mCoeffInfo;
+    BlockPatternMargins<double> mMargins;
+};
+
+///
+/// \brief Creates the items of the postopt tree on demand.
+/// \remark The symbol groups and entry lines get a loader, which creates
+///         their children from the sparse rows and columns when they are
+///         expanded. The entry lines of a symbol are created in batches of
+///         <c>EntryBatchSize</c>, i.e. each fetch creates one batch. The
+///         builder keeps copies of the filters and shares the Jacobian, i.e.
+///         a tree which is still shown stays consistent if the view changes.
+///         The model instance is only referenced weakly, because it owns the
+///         tree.
+///
+class PostoptTreeBuilder final : public QEnableSharedFromThis<PostoptTreeBuilder>
+{
+public:
+    PostoptTreeBuilder(const QSharedPointer<AbstractModelInstance> &modelInstance,
+                       const QSharedPointer<DataMatrix> &dataMatrix,
+                       const QVector<int> &equationIndex,
+                       const QVector<int> &variableIndex,
+                       const QSharedPointer<AbstractViewConfiguration> &viewConfig)
+        : mModelInstance(modelInstance)
+        , mDataMatrix(dataMatrix)
+        , mEquationIndex(equationIndex)
+        , mVariableIndex(variableIndex)
+        , mAnyLabel(viewConfig->currentLabelFiler().Any)
+        , mAttributeFilter(viewConfig->currentAttributeFilter())
+        , mAbsolute(viewConfig->currentValueFilter().isAbsolute())
+    {
+        const auto& checkStates = viewConfig->currentLabelFiler().LabelCheckStates;
+        mEquationFilter = SymbolFilterModel::compile(checkStates.value(Qt::Vertical),
+                                                     modelInstance->labels());
+        mVariableFilter = SymbolFilterModel::compile(checkStates.value(Qt::Horizontal),
+                                                     modelInstance->labels());
+        for (auto type : AttributeHelper::attributeTypeList()) {
+            if (mAttributeFilter.value(AttributeHelper::attributeText(type)) != Qt::Unchecked) {
+                mHasAttributes = true;
+                break;
+            }
+        }
+    }
+
+    ///
+    /// \brief Group of <c>symbol</c>, which creates its entry lines on demand.
+    ///
+    PostoptTreeItem* symbolGroup(Symbol *symbol)
+    {
+        auto group = new GroupPostoptTreeItem(symbol->name());
+        auto builder = sharedFromThis();
+        group->setLoader([builder, symbol](PostoptTreeItem *item) {
+            return builder->loadEntries(item, symbol, 0);
+        });
+        return group;
+    }
+
+private:
+    ///
+    /// \brief Creates the next batch of entry lines of <c>symbol</c>,
+    ///        starting at entry <c>first</c>.
+    /// \remark If entries are left, <c>group</c> gets a loader for the next
+    ///         batch. An entry line only gets a loader if it has attributes
+    ///         or at least one partner which passes the label filter.
+    ///
+    QVector<PostoptTreeItem*> loadEntries(PostoptTreeItem *group, Symbol *symbol, int first)
+    {
+        QVector<PostoptTreeItem*> entries;
+        auto modelInstance = mModelInstance.toStrongRef();
+        if (!modelInstance)
+            return entries;
+        auto orientation = symbol->isEquation() ? Qt::Vertical : Qt::Horizontal;
+        auto builder = sharedFromThis();
+        int e = first;
+        for (; e<symbol->entries() && entries.size()<EntryBatchSize; ++e) {
+            if (skipEntry(symbol, e, orientation))
+                continue;
+            auto line = new GroupPostoptTreeItem(symbolName(symbol, e));
+            if (mHasAttributes || hasPartners(*modelInstance, symbol, e)) {
+                line->setLoader([builder, symbol, e](PostoptTreeItem*) {
+                    return builder->loadEntry(symbol, e);
+                });
+            }
+            entries.append(line);
+        }
+        if (e < symbol->entries()) {
+            group->setLoader([builder, symbol, e](PostoptTreeItem *item) {
+                return builder->loadEntries(item, symbol, e);
+            });
+        }
+        return entries;
+    }
+
+    QVector<PostoptTreeItem*> loadEntry(Symbol *symbol, int entry)
+    {
+        QVector<PostoptTreeItem*> items;
+        auto modelInstance = mModelInstance.toStrongRef();
+        if (!modelInstance)
+            return items;
+        if (auto attributes = loadAttributes(*modelInstance, symbol, entry))
+            items.append(attributes);
+        auto partners = symbol->isEquation() ? loadVariables(*modelInstance, symbol, entry)
+                                             : loadEquations(*modelInstance, symbol, entry);
+        if (partners)
+            items.append(partners);
+        return items;
+    }
+
+    ///
+    /// \brief Checks if the Jacobian row or column of <c>entry</c> has a
+    ///        partner which passes the label filter.
+    ///
+    bool hasPartners(AbstractModelInstance &modelInstance, Symbol *symbol, int entry)
+    {
+        int section = symbol->firstSection()+entry;
+        if (symbol->isEquation()) {
+            auto row = mDataMatrix->row(section);
+            for (int i=0; i<row.entries(); ++i) {
+                int column = row.colIdx()[i];
+                auto variable = modelInstance.variables().value(mVariableIndex.value(column, -1));
+                if (variable && !skipEntry(variable, column-variable->firstSection(), Qt::Horizontal))
+                    return true;
+            }
+            return false;
+        }
+        auto rows = mDataMatrix->columnRows(section);
+        for (int i=0; i<mDataMatrix->columnEntries(section); ++i) {
+            auto equation = modelInstance.equations().value(mEquationIndex.value(rows[i], -1));
+            if (equation && !skipEntry(equation, rows[i]-equation->firstSection(), Qt::Vertical))
+                return true;
+        }
+        return false;
     }
 
-    auto& operator=(const BPAverageDataProvider& other)
+    PostoptTreeItem* loadAttributes(AbstractModelInstance &modelInstance, Symbol *symbol, int entry)
     {
-        for (int r=0; r<mRowCount; ++r) {
-            delete [] mDataMatrix[r];
+        auto attributes = new GroupPostoptTreeItem(ViewHelper::AttributeHeaderText);
+        for (auto type : AttributeHelper::attributeTypeList()) {
+            auto label = AttributeHelper::attributeText(type);
+            if (mAttributeFilter.value(label) == Qt::Unchecked) {
+                continue;
+            }
+            QVariant value;
+            if (symbol->isEquation()) {
+                value = modelInstance.equationAttribute(type, symbol->firstSection(), entry, mAbsolute);
+            } else if (symbol->isVariable()) {
+                value = modelInstance.variableAttribute(type, symbol->firstSection(), entry, mAbsolute);
+            }
+            attributes->append(new LinePostoptTreeItem({label, numericValue(value)}));
         }
-        delete [] mDataMatrix;
-        mDataMatrix = new double*[mRowCount];
-        for (int r=0; r<mRowCount; ++r) {
-            mDataMatrix[r] = new double[mColumnCount];
-            std::copy(other.mDataMatrix[r], other.mDataMatrix[r]+other.mColumnCount, mDataMatrix[r]);
+        return takeGroup(attributes);
+    }
+
+    PostoptTreeItem* loadEquations(AbstractModelInstance &modelInstance, Symbol *variable, int entry)
+    {
+        auto equations = new LinePostoptTreeItem(PostoptTreeItem::EquationLineHeader);
+        int column = variable->firstSection()+entry;
+        auto rows = mDataMatrix->columnRows(column);
+        auto offsets = mDataMatrix->columnOffsets(column);
+        Symbol *equation = nullptr;
+        PostoptTreeItem *eqnGroup = nullptr;
+        for (int i=0; i<mDataMatrix->columnEntries(column); ++i) {
+            auto symbol = modelInstance.equations().value(mEquationIndex.value(rows[i], -1));
+            if (!symbol)
+                continue;
+            if (symbol != equation) {
+                appendGroup(eqnGroup, equations);
+                equation = symbol;
+                eqnGroup = new GroupPostoptTreeItem(equation->name());
+            }
+            int e = rows[i] - equation->firstSection();
+            if (skipEntry(equation, e, Qt::Vertical))
+                continue;
+            double jacval = mDataMatrix->outputData()[offsets[i]];
+            auto name = symbolName(equation, e);
+            double jac = value(jacval);
+            double xi = modelInstance.equationAttribute(AttributeHelper::MarginalNum, equation->firstSection(), e, mAbsolute).toDouble();
+            double jacxi = value(jacval * xi);
+            eqnGroup->append(new LinePostoptTreeItem({name, numericValue(jac), numericValue(xi),
+                                                      numericValue(jacxi)}));
         }
-        mCoeffInfo = other.mCoeffInfo;
-        for (int r=0; r<mRowCount; ++r) {
-            delete [] mNlFlags[r];
+        appendGroup(eqnGroup, equations);
+        return takeGroup(equations);
+    }
+
+    ///
+    /// \brief Loads the variables of one equation row, where the sorted
+    ///         column indices keep the entries of a variable together.
+    ///
+    PostoptTreeItem* loadVariables(AbstractModelInstance &modelInstance, Symbol *equation, int entry)
+    {
+        auto variables = new LinePostoptTreeItem(PostoptTreeItem::VariableLineHeader);
+        auto row = mDataMatrix->row(equation->firstSection()+entry);
+        Symbol *variable = nullptr;
+        PostoptTreeItem *varGroup = nullptr;
+        for (int i=0; i<row.entries(); ++i) {
+            int column = row.colIdx()[i];
+            auto symbol = modelInstance.variables().value(mVariableIndex.value(column, -1));
+            if (!symbol)
+                continue;
+            if (symbol != variable) {
+                appendGroup(varGroup, variables);
+                variable = symbol;
+                varGroup = new GroupPostoptTreeItem(variable->name());
+            }
+            int e = column - variable->firstSection();
+            if (skipEntry(variable, e, Qt::Horizontal))
+                continue;
+            auto name = symbolName(variable, e);
+            double jac = value(row.outputData()[i]);
+            double ui = modelInstance.variableAttribute(AttributeHelper::Level, variable->firstSection(), e, mAbsolute).toDouble();
+            double jacui = value(jac * ui);
+            varGroup->append(new LinePostoptTreeItem({name, numericValue(jac), numericValue(ui),
+                                                      numericValue(jacui)}));
         }
-        if (mNlFlags) delete [] mNlFlags;
-        mNlFlags = new int*[mRowCount];
-        for (int r=0; r<mRowCount; ++r) {
-            mNlFlags[r] = new int[mColumnCount];
-            std::copy(other.mNlFlags[r], other.mNlFlags[r]+other.mColumnCount, mNlFlags[r]);
+        appendGroup(varGroup, variables);
+        return takeGroup(variables);
+    }
+
+    static void appendGroup(PostoptTreeItem *group, PostoptTreeItem *parent)
+    {
+        if (!group)
+            return;
+        if (group->rowCount()) {
+            parent->append(group);
+        } else {
+            delete group;
         }
-        return *this;
     }
 
-    auto& operator=(BPAverageDataProvider&& other) noexcept
+    static PostoptTreeItem* takeGroup(PostoptTreeItem *group)
     {
-        mDataMatrix = other.mDataMatrix;
-        other.mDataMatrix = nullptr;
-        mCoeffInfo = std::move(other.mCoeffInfo);
-        mNlFlags = other.mNlFlags;
-        other.mNlFlags = nullptr;
-        return *this;
+        if (group->rowCount())
+            return group;
+        delete group;
+        return nullptr;
+    }
+
+    QString symbolName(Symbol *symbol, int entry)
+    {
+        if (symbol->isScalar())
+            return symbol->name();
+        auto labels = symbol->sectionLabels(symbol->firstSection()+entry);
+        if (labels.isEmpty())
+            return QString("(..)");
+        return QString("%1(%2)").arg(symbol->name(), labels.join(", "));
+    }
+
+    ///
+    /// \brief Evaluates the label filter with the compiled UEL sets, i.e.
+    ///        the same predicate as the symbol views.
+    ///
+    bool skipEntry(Symbol *symbol, int entry, Qt::Orientation orientation) const
+    {
+        if (symbol->isScalar())
+            return false;
+        const auto& filter = orientation == Qt::Vertical ? mEquationFilter : mVariableFilter;
+        int section = symbol->firstSection()+entry;
+        return mAnyLabel ? !SymbolFilterModel::matchesAnyLabels(filter, symbol, section)
+                         : !SymbolFilterModel::matchesAllLabels(filter, symbol, section);
+    }
+
+    double value(double value) const
+    {
+        return mAbsolute ? std::abs(value) : value;
+    }
+
+    ///
+    /// \brief Cell data of a value column, which is classified once here
+    ///        instead of on each access of the postopt proxy.
+    ///
+    static QVariant numericValue(double value)
+    {
+        return QVariant::fromValue(NumericValue(value));
+    }
+
+    static QVariant numericValue(const QVariant &value)
+    {
+        auto numeric = NumericValue::fromVariant(value);
+        return numeric.Valid ? QVariant::fromValue(numeric) : value;
     }
 
 private:
-    double** mDataMatrix;
-    QSharedPointer<DataHandler::CoefficientInfo> mCoeffInfo;
-    int** mNlFlags = nullptr;
+    static const int EntryBatchSize = 512;
+
+    QWeakPointer<AbstractModelInstance> mModelInstance;
+    QSharedPointer<DataMatrix> mDataMatrix;
+    QVector<int> mEquationIndex;
+    QVector<int> mVariableIndex;
+    bool mAnyLabel;
+    SymbolFilterModel::UelFilter mEquationFilter;
+    SymbolFilterModel::UelFilter mVariableFilter;
+    LabelCheckStates mAttributeFilter;
+    bool mHasAttributes = false;
+    bool mAbsolute;
 };
 
 class PostoptDataProvider final : public DataHandler::AbstractDataProvider
@@ -1545,7 +2018,6 @@ public:
     {
         mColumnCount = 5;
         mRootItem = QSharedPointer<PostoptTreeItem>(new LinePostoptTreeItem());
-        value = std::bind(&PostoptDataProvider::identity, this, std::placeholders::_1);
     }
 
     PostoptDataProvider(const PostoptDataProvider& other)
@@ -1567,13 +2039,15 @@ public:
 
     }
 
+    ///
+    /// \brief Creates the symbol groups, where all other items are created
+    ///        on demand.
+    ///
     void loadData() override
     {
-        if (mViewConfig->currentValueFilter().isAbsolute()) {
-            value = std::bind(&PostoptDataProvider::abs, this, std::placeholders::_1);
-        } else {
-            value = std::bind(&PostoptDataProvider::identity, this, std::placeholders::_1);
-        }
+        auto builder = QSharedPointer<PostoptTreeBuilder>::create(mModelInstance.sharedFromThis(), dataMatrix(),
+                                                                  equationIndex(), variableIndex(),
+                                                                  mViewConfig);
         mRootItem = QSharedPointer<PostoptTreeItem>(new LinePostoptTreeItem());
 
         auto equations = new GroupPostoptTreeItem(ViewHelper::EquationHeaderText);
@@ -1582,29 +2056,9 @@ public:
             if (!eqnFilter[equation->firstSection()].Checked) {
                 continue;
             }
-            auto eqnGroup = new GroupPostoptTreeItem(equation->name(), equations);
-            for (int e=0; e<equation->entries(); ++e) {
-                if (skipEntry(equation, e, Qt::Vertical))
-                    continue;
-                auto eqnLine = new GroupPostoptTreeItem(symbolName(equation, e));
-                loadAttributes(equation, e, eqnLine);
-                loadVariables(equation, e, eqnLine);
-                if (eqnLine->rowCount()) {
-                    eqnLine->setParent(eqnGroup);
-                    eqnGroup->append(eqnLine);
-                } else {
-                    delete eqnLine;
-                }
-            }
-            if (eqnGroup->rowCount()) {
-                eqnGroup->setParent(equations);
-                equations->append(eqnGroup);
-            } else {
-                delete eqnGroup;
-            }
+            equations->append(builder->symbolGroup(equation));
         }
         if (equations->rowCount()) {
-            equations->setParent(mRootItem.get());
             mRootItem->append(equations);
         } else {
             delete equations;
@@ -1616,29 +2070,9 @@ public:
             if (!varFilter[variable->firstSection()].Checked) {
                 continue;
             }
-            auto varGroup = new GroupPostoptTreeItem(variable->name());
-            for (int e=0; e<variable->entries(); ++e) {
-                if (skipEntry(variable, e, Qt::Horizontal))
-                    continue;
-                auto varLine = new GroupPostoptTreeItem(symbolName(variable, e));
-                loadAttributes(variable, e, varLine);
-                loadEquations(variable, e, varLine);
-                if (varLine->rowCount()) {
-                    varLine->setParent(varGroup);
-                    varGroup->append(varLine);
-                } else {
-                    delete varLine;
-                }
-            }
-            if (varGroup->rowCount()) {
-                varGroup->setParent(variables);
-                variables->append(varGroup);
-            } else {
-                delete varGroup;
-            }
+            variables->append(builder->symbolGroup(variable));
         }
         if (variables->rowCount()) {
-            variables->setParent(mRootItem.get());
             mRootItem->append(variables);
         } else {
             delete variables;
@@ -1674,150 +2108,8 @@ public:
         return *this;
     }
 
-private:
-    void loadAttributes(Symbol *symbol, int entry, PostoptTreeItem *parent)
-    {
-        bool abs = mViewConfig->currentValueFilter().isAbsolute();
-        auto attributes = new GroupPostoptTreeItem(ViewHelper::AttributeHeaderText);
-        for (const auto& label : AttributeHelper::attributeTextList()) {
-            if (mViewConfig->currentAttributeFilter().value(label) == Qt::Unchecked) {
-                continue;
-            }
-            QVariant value;
-            if (symbol->isEquation()) {
-                value = mModelInstance.equationAttribute(label, symbol->firstSection(), entry, abs);
-            } else if (symbol->isVariable()) {
-                value = mModelInstance.variableAttribute(label, symbol->firstSection(), entry, abs);
-            }
-            attributes->append(new LinePostoptTreeItem({label, value}, attributes));
-        }
-        if (attributes->rowCount()) {
-            attributes->setParent(parent);
-            parent->append(attributes);
-        } else {
-            delete attributes;
-        }
-    }
-
-    void loadEquations(Symbol *variable, int entry, PostoptTreeItem *parent)
-    {
-        bool abs = mViewConfig->currentValueFilter().isAbsolute();
-        auto equations = new LinePostoptTreeItem(PostoptTreeItem::EquationLineHeader);
-        for (auto equation : mModelInstance.equations()) {
-            auto eqnGroup = new GroupPostoptTreeItem(equation->name());
-            for (int e=0; e<equation->entries(); ++e) {
-                if (skipEntry(equation, e, Qt::Vertical))
-                    continue;
-                auto row = dataRow(equation->firstSection()+e);
-                QVariant jacval;
-                if (row) {
-                    jacval = row->outputValue(variable->firstSection()+entry, variable->lastSection());
-                }
-                if (jacval.isValid()) {
-                    auto name = symbolName(equation, e);
-                    double jac = value(jacval.toDouble());
-                    double xi = mModelInstance.equationAttribute(AttributeHelper::MarginalNumText, equation->firstSection(), e, abs).toDouble();
-                    double jacxi = value(jacval.toDouble() * xi);
-                    eqnGroup->append(new LinePostoptTreeItem({name, jac, xi, jacxi}, eqnGroup));
-                }
-            }
-            if (eqnGroup->rowCount()) {
-                eqnGroup->setParent(equations);
-                equations->append(eqnGroup);
-            } else {
-                delete eqnGroup;
-            }
-        }
-        if (equations->rowCount()) {
-            equations->setParent(parent);
-            parent->append(equations);
-        } else {
-            delete equations;
-        }
-    }
-
-    void loadVariables(Symbol *equation, int entry, PostoptTreeItem *parent)
-    {
-        bool abs = mViewConfig->currentValueFilter().isAbsolute();
-        auto variables = new LinePostoptTreeItem(PostoptTreeItem::VariableLineHeader);
-        for (auto variable : mModelInstance.variables()) {
-            auto varGroup = new GroupPostoptTreeItem(variable->name());
-            for (int e=0; e<variable->entries(); ++e) {
-                if (skipEntry(variable, e, Qt::Horizontal))
-                    continue;
-                auto row = dataRow(equation->firstSection()+entry);
-                QVariant jacval;
-                if (row) {
-                    jacval = row->outputValue(variable->firstSection()+e, variable->lastSection());
-                }
-                if (jacval.isValid()) {
-                    auto name = symbolName(variable, e);
-                    double jac = value(jacval.toDouble());
-                    double ui = mModelInstance.variableAttribute(AttributeHelper::LevelText, variable->firstSection(), e, abs).toDouble();
-                    double jacui = value(jac * ui);
-                    varGroup->append(new LinePostoptTreeItem({name, jac, ui, jacui}, varGroup));
-                }
-            }
-            if (varGroup->rowCount()) {
-                varGroup->setParent(variables);
-                variables->append(varGroup);
-            } else {
-                delete varGroup;
-            }
-        }
-        if (variables->rowCount()) {
-            variables->setParent(parent);
-            parent->append(variables);
-        } else {
-            delete variables;
-        }
-    }
-
-    QString symbolName(Symbol *symbol, int entry)
-    {
-        if (symbol->isScalar())
-            return symbol->name();
-        int index = symbol->firstSection()+entry;
-        if (!symbol->sectionLabels().contains(index))
-            return QString("(..)");
-        return QString("%1(%2)").arg(symbol->name(), symbol->sectionLabels()[index].join(", "));
-    }
-
-    bool skipEntry(Symbol *symbol, int entry, Qt::Orientation orientation)
-    {
-        if (symbol->isScalar())
-            return false;
-        int index = symbol->firstSection()+entry;
-        auto labels = symbol->sectionLabels().value(index);
-        auto states = mViewConfig->currentLabelFiler().LabelCheckStates.value(orientation);
-        if (mViewConfig->currentLabelFiler().Any) {
-            for (const auto& label : labels) {
-                if (states.value(label) == Qt::Checked)
-                    return false;
-            }
-        } else {
-            for (const auto& label : labels) {
-                if (states.value(label) == Qt::Unchecked)
-                    return true;
-            }
-            return false;
-        }
-        return true;
-    }
-
-    double abs(double value)
-    {
-        return std::abs(value);
-    }
-
-    double identity(double value)
-    {
-        return value;
-    }
-
 private:
     QSharedPointer<PostoptTreeItem> mRootItem;
-    std::function<double(double)> value;
 };
 
 DataHandler::DataHandler(AbstractModelInstance& modelInstance)
@@ -1832,19 +2124,6 @@ DataHandler::~DataHandler()
 
 }
 
-void DataHandler::aggregate(const QSharedPointer<AbstractViewConfiguration> &viewConfig)
-{
-    if (!viewConfig) return;
-    auto provider = newProvider(viewConfig);
-    mDataCache.remove(viewConfig->viewId());
-    if (viewConfig->currentAggregation().type() != Aggregation::None) {
-        provider->loadData();
-    } else {
-        return;
-    }
-    mDataCache[viewConfig->viewId()] = provider;
-}
-
 void DataHandler::loadData(const QSharedPointer<AbstractViewConfiguration> &viewConfig)
 {
     if (!viewConfig)
@@ -1852,15 +2131,47 @@ void DataHandler::loadData(const QSharedPointer<AbstractViewConfiguration> &view
     auto provider = newProvider(viewConfig);
     mDataCache.remove(viewConfig->viewId());
     provider->loadData();
+    provider->indexSections();
     mDataCache[viewConfig->viewId()] = provider;
 }
 
+bool DataHandler::updateData(const QSharedPointer<AbstractViewConfiguration> &viewConfig)
+{
+    if (!viewConfig)
+        return false;
+    auto provider = mDataCache.constFind(viewConfig->viewId());
+    if (provider != mDataCache.constEnd() && isProviderOf(*provider, viewConfig) &&
+            (*provider)->updateValueFilter()) {
+        return false;
+    }
+    loadData(viewConfig);
+    return true;
+}
+
+bool DataHandler::isProviderOf(const QSharedPointer<AbstractDataProvider> &provider,
+                               const QSharedPointer<AbstractViewConfiguration> &viewConfig) const
+{
+    if (provider->viewConfig() != viewConfig)
+        return false;
+    if (viewConfig->viewType() != ViewHelper::ViewDataType::Symbols)
+        return true;
+    bool aggregated = dynamic_cast<AggregationDataProvider*>(provider.get());
+    return aggregated == AggregationDataProvider::isAggregated(viewConfig);
+}
+
 QVariant DataHandler::data(int row, int column, int viewId) const
 {
-    if (mDataCache.contains(viewId) && mDataCache[viewId]->data(row, column) != 0.0) {
-        return mDataCache[viewId]->data(row, column);
-    }
-    return QVariant();
+    auto value = numericData(row, column, viewId);
+    return value.Valid ? QVariant(value.Value) : QVariant();
+}
+
+NumericValue DataHandler::numericData(int row, int column, int viewId) const
+{
+    auto provider = mDataCache.constFind(viewId);
+    if (provider == mDataCache.constEnd())
+        return NumericValue();
+    double value = (*provider)->data(row, column);
+    return value != 0.0 ? NumericValue(value) : NumericValue();
 }
 
 int DataHandler::nlFlag(int row, int column, int viewId)
@@ -1896,6 +2207,14 @@ int DataHandler::headerData(int logicalIndex,
                                        : -1;
 }
 
+QList<int> DataHandler::logicalIndices(int section,
+                                      Qt::Orientation orientation,
+                                      int viewId) const
+{
+    return mDataCache.contains(viewId) ? mDataCache[viewId]->logicalIndices(orientation, section)
+                                       : QList<int>();
+}
+
 QVariant DataHandler::plainHeaderData(Qt::Orientation orientation,
                                       int viewId, int logicalIndex,
                                       int dimension) const
@@ -1985,6 +2304,67 @@ QSharedPointer<AbstractViewConfiguration> DataHandler::clone(int viewId, int new
 void DataHandler::loadJacobian()
 {
     mDataMatrix.reset(mModelInstance.jacobianData());
+    if (mDataMatrix)
+        mDataMatrix->buildColumnIndex();
+    mEquationIndex.fill(-1, mModelInstance.equationRowCount());
+    for (const auto& equation : mModelInstance.equations()) {
+        for (int s=equation->firstSection(); s<=equation->lastSection(); ++s) {
+            mEquationIndex[s] = equation->logicalIndex();
+        }
+    }
+    mVariableIndex.fill(-1, mModelInstance.variableRowCount());
+    for (const auto& variable : mModelInstance.variables()) {
+        for (int s=variable->firstSection(); s<=variable->lastSection(); ++s) {
+            mVariableIndex[s] = variable->logicalIndex();
+        }
+    }
+    mRhs.fill(0.0, mModelInstance.equationRowCount());
+    mModelInstance.equationRhs(mRhs.data());
+    mCoeffCount.reset();
+}
+
+QSharedPointer<const DataHandler::CoefficientInfo> DataHandler::coefficientInfo()
+{
+    if (mCoeffCount)
+        return mCoeffCount;
+    mCoeffCount.reset(new CoefficientInfo(mModelInstance.equationCount(),
+                                          mModelInstance.variableCount()));
+    QVector<int> blockIndex(mModelInstance.variableCount(), -1);
+    QVector<int> columns;
+    int equationIndex = 0;
+    for (const auto& equation : mModelInstance.equations()) {
+        mCoeffCount->setEquationType(equationIndex, mModelInstance.equationType(equation->firstSection()));
+        for (int r=equation->firstSection(); mDataMatrix && r<=equation->lastSection(); ++r) {
+            mCoeffCount->addRhs(equationIndex, mRhs[r]);
+            auto sparseRow = mDataMatrix->row(r);
+            for (int i=0; i<sparseRow.entries(); ++i) {
+                auto column = mVariableIndex[sparseRow.colIdx()[i]];
+                if (blockIndex[column] < 0) {
+                    blockIndex[column] = 0;
+                    columns.append(column);
+                }
+            }
+        }
+        std::sort(columns.begin(), columns.end());
+        mCoeffCount->appendBlocks(columns);
+        for (int b=0; b<columns.size(); ++b) {
+            blockIndex[columns[b]] = mCoeffCount->firstBlock(equationIndex) + b;
+        }
+        for (int r=equation->firstSection(); mDataMatrix && r<=equation->lastSection(); ++r) {
+            auto sparseRow = mDataMatrix->row(r);
+            auto data = mModelInstance.useOutput() ? sparseRow.outputData() : sparseRow.inputData();
+            for (int i=0; i<sparseRow.entries(); ++i) {
+                mCoeffCount->addCoefficient(blockIndex[mVariableIndex[sparseRow.colIdx()[i]]],
+                                            data[i], sparseRow.nlFlag(i));
+            }
+        }
+        for (int column : columns) {
+            blockIndex[column] = -1;
+        }
+        columns.clear();
+        ++equationIndex;
+    }
+    return mCoeffCount;
 }
 
 DataHandler::AbstractDataProvider* DataHandler::cloneProvider(int viewId)
@@ -1997,6 +2377,8 @@ DataHandler::AbstractDataProvider* DataHandler::cloneProvider(int viewId)
     }
     case ViewHelper::ViewDataType::Symbols:
     {
+        if (auto provider = dynamic_cast<AggregationDataProvider*>(mDataCache[viewId].get()))
+            return new AggregationDataProvider(*provider);
         auto provider = static_cast<SymbolsDataProvider*>(mDataCache[viewId].get());
         return new SymbolsDataProvider(*provider);
     }
@@ -2030,17 +2412,18 @@ DataHandler::AbstractDataProvider* DataHandler::cloneProvider(int viewId)
 
 QSharedPointer<DataHandler::AbstractDataProvider> DataHandler::newProvider(const QSharedPointer<AbstractViewConfiguration> &viewConfig)
 {
-    if (!mCoeffCount || viewConfig->viewId() == (int)ViewHelper::ViewDataType::BP_Scaling) {
-        mCoeffCount.reset(new CoefficientInfo(mModelInstance.variableCount()+2,
-                                              mModelInstance.equationCount()*2));
-    }
     switch (viewConfig->viewType()) {
     case ViewHelper::ViewDataType::BP_Scaling:
         return QSharedPointer<AbstractDataProvider>(new BPScalingProvider(this,
                                                                           mModelInstance,
                                                                           viewConfig,
-                                                                          mCoeffCount));
+                                                                          coefficientInfo()));
     case ViewHelper::ViewDataType::Symbols:
+        if (AggregationDataProvider::isAggregated(viewConfig)) {
+            return QSharedPointer<AbstractDataProvider>(new AggregationDataProvider(this,
+                                                                                    mModelInstance,
+                                                                                    viewConfig));
+        }
         return QSharedPointer<AbstractDataProvider>(new SymbolsDataProvider(this,
                                                                             mModelInstance,
                                                                             viewConfig));
@@ -2048,17 +2431,17 @@ QSharedPointer<DataHandler::AbstractDataProvider> DataHandler::newProvider(const
         return QSharedPointer<AbstractDataProvider>(new BPOverviewDataProvider(this,
                                                                                mModelInstance,
                                                                                viewConfig,
-                                                                               mCoeffCount));
+                                                                               coefficientInfo()));
     case ViewHelper::ViewDataType::BP_Count:
         return QSharedPointer<AbstractDataProvider>(new BPCountDataProvider(this,
                                                                             mModelInstance,
                                                                             viewConfig,
-                                                                            mCoeffCount));
+                                                                            coefficientInfo()));
     case ViewHelper::ViewDataType::BP_Average:
         return QSharedPointer<AbstractDataProvider>(new BPAverageDataProvider(this,
                                                                               mModelInstance,
                                                                               viewConfig,
-                                                                              mCoeffCount));
+                                                                              coefficientInfo()));
     case ViewHelper::ViewDataType::Postopt:
         return QSharedPointer<AbstractDataProvider>(new PostoptDataProvider(this,
                                                                             mModelInstance,
@@ -22,8 +22,12 @@
 #define DATAHANDLER_H
 
 #include <QVariant>
+#include <QVector>
 #include <QSharedPointer>
 
+#include "common.h"
+#include "nlflags.h"
+
 namespace gams {
 namespace studio {
 namespace mii {
@@ -41,135 +45,202 @@ class DataHandler
 public:
     class AbstractDataProvider;
 
+    ///
+    /// \brief Coefficient counts and nonlinear flags of the (equation symbol,
+    ///        variable symbol) blocks, which are shared by the block pattern
+    ///        views.
+    /// \remark Only the blocks with nonzeros are stored, in a compressed row
+    ///         index over the equation symbols. The views derive their cells
+    ///         from these blocks, i.e. no dense symbol grid is kept.
+    ///
     struct CoefficientInfo
     {
-        CoefficientInfo(const CoefficientInfo& other)
-            : mRowCount(other.mRowCount)
-            , mColumnCount(other.mColumnCount)
-            , mCount(new int*[mRowCount])
-            , mNlFlags(new int*[mRowCount])
+        CoefficientInfo(int equationCount, int variableCount)
+            : mVariableCount(variableCount)
+            , mEquationType(equationCount, 0)
+            , mNegativeRhs(equationCount, 0)
+            , mPositiveRhs(equationCount, 0)
+        {
+            mBlockRowPtr.reserve(equationCount+1);
+            mBlockRowPtr.append(0);
+        }
+
+        int equationCount() const
+        {
+            return mEquationType.size();
+        }
+
+        int variableCount() const
+        {
+            return mVariableCount;
+        }
+
+        ///
+        /// \brief Appends the blocks of the next equation symbol, where all
+        ///        counts start with zero.
+        /// \param columns Variable symbols with nonzeros in ascending order.
+        /// \remark Has no effect if the blocks of all equation symbols are
+        ///         appended already.
+        ///
+        void appendBlocks(const QVector<int> &columns)
+        {
+            if (mBlockRowPtr.size() > equationCount())
+                return;
+            mBlockColumns.append(columns);
+            mBlockRowPtr.append(mBlockColumns.size());
+            mNegativeCount.resize(mBlockColumns.size());
+            mPositiveCount.resize(mBlockColumns.size());
+            mNlFlags.resize(NlFlags::words(mBlockColumns.size()));
+        }
+
+        ///
+        /// \brief Number of populated blocks of all equation symbols.
+        ///
+        int blockCount() const
+        {
+            return mBlockColumns.size();
+        }
+
+        ///
+        /// \brief Number of populated blocks of <c>equation</c>, which is
+        ///        0 if the blocks are not appended yet.
+        ///
+        int blockCount(int equation) const
+        {
+            if (equation < 0 || equation+1 >= mBlockRowPtr.size())
+                return 0;
+            return mBlockRowPtr[equation+1] - mBlockRowPtr[equation];
+        }
+
+        ///
+        /// \brief Variable symbols of the populated blocks of <c>equation</c>.
+        ///
+        const int* blockColumns(int equation) const
+        {
+            return mBlockColumns.constData() + firstBlock(equation);
+        }
+
+        ///
+        /// \brief Block index of the first block of <c>equation</c>, i.e.
+        ///        block <c>b</c> of the equation is <c>firstBlock()+b</c>.
+        ///
+        int firstBlock(int equation) const
         {
-            for (int r=0; r<mRowCount; ++r) {
-                mCount[r] = new int[mColumnCount];
-                mNlFlags[r] = new int[mColumnCount];
-                std::copy(other.mCount[r], other.mCount[r]+other.mColumnCount, mCount[r]);
-                std::copy(other.mNlFlags[r], other.mNlFlags[r]+other.mColumnCount, mNlFlags[r]);
-            }
+            return mBlockRowPtr.value(equation);
         }
 
-        CoefficientInfo(CoefficientInfo&& other) noexcept
-            : mRowCount(other.mRowCount)
-            , mColumnCount(other.mColumnCount)
-            , mCount(other.mCount)
-            , mNlFlags(other.mNlFlags)
+        ///
+        /// \brief Block index of (<c>equation</c>, <c>variable</c>).
+        /// \return The block index or -1 if the block has no nonzeros.
+        ///
+        int block(int equation, int variable) const
         {
-            other.mCount = nullptr;
-            other.mNlFlags = nullptr;
-            other.mColumnCount = 0;
-            other.mRowCount = 0;
+            auto first = blockColumns(equation);
+            auto last = first + blockCount(equation);
+            auto iter = std::lower_bound(first, last, variable);
+            return iter != last && *iter == variable ? firstBlock(equation) + int(iter-first) : -1;
         }
 
-        CoefficientInfo(int columnCount, int rowCount)
-            : mRowCount(rowCount)
-            , mColumnCount(columnCount)
-            , mCount(new int*[mRowCount])
-            , mNlFlags(new int*[mRowCount])
+        int negativeCount(int block) const
         {
-            for (int r=0; r<mRowCount; ++r) {
-                mCount[r] = new int[mColumnCount];
-                mNlFlags[r] = new int[mColumnCount];
-                std::fill(mCount[r], mCount[r]+mColumnCount, 0);
-                std::fill(mNlFlags[r], mNlFlags[r]+mColumnCount, 0);
-            }
+            return mNegativeCount[block];
         }
 
-        ~CoefficientInfo()
+        int positiveCount(int block) const
         {
-            for (int r=0; r<mRowCount; ++r) {
-                delete [] mCount[r];
-            }
-            if (mCount) delete [] mCount;
-            for (int r=0; r<mRowCount; ++r) {
-                delete [] mNlFlags[r];
-            }
-            if (mNlFlags) delete [] mNlFlags;
+            return mPositiveCount[block];
         }
 
-        int** count()
+        bool nlFlag(int block) const
         {
-            return mCount;
+            return NlFlags::test(mNlFlags.constData(), block);
         }
 
-        int** nlFlags()
+        ///
+        /// \brief Nonlinear flag of (<c>equation</c>, <c>variable</c>),
+        ///        which is <c>false</c> for blocks without nonzeros.
+        ///
+        bool nlFlag(int equation, int variable) const
         {
-            return mNlFlags;
+            int index = block(equation, variable);
+            return index >= 0 && nlFlag(index);
         }
 
-        int columnCount() const
+        ///
+        /// \brief Counts the sign and nonlinearity of a coefficient of
+        ///        <c>block</c>.
+        ///
+        void addCoefficient(int block, double value, bool nonlinear)
         {
-            return mColumnCount;
+            if (value < 0)
+                ++mNegativeCount[block];
+            else if (value > 0)
+                ++mPositiveCount[block];
+            if (nonlinear)
+                NlFlags::set(mNlFlags.data(), block);
         }
 
-        int rowCount() const
+        int equationType(int equation) const
         {
-            return mRowCount;
+            return mEquationType[equation];
         }
 
-        auto& operator=(const CoefficientInfo& other)
+        void setEquationType(int equation, int type)
         {
-            mRowCount = other.mColumnCount;
-            mColumnCount = other.mColumnCount;
-            for (int r=0; r<mRowCount; ++r) {
-                delete [] mCount[r];
-            }
-            if (mCount) delete [] mCount;
-            mCount = new int*[mRowCount];
-            for (int r=0; r<mRowCount; ++r) {
-                mCount[r] = new int[mColumnCount];
-                std::copy(other.mCount[r], other.mCount[r]+other.mColumnCount, mCount[r]);
-            }
-            for (int r=0; r<mRowCount; ++r) {
-                delete [] mNlFlags[r];
-            }
-            if (mNlFlags) delete [] mNlFlags;
-            mNlFlags = new int*[mRowCount];
-            for (int r=0; r<mRowCount; ++r) {
-                mNlFlags[r] = new int[mColumnCount];
-                std::copy(other.mNlFlags[r], other.mNlFlags[r]+other.mColumnCount, mNlFlags[r]);
-            }
-            return *this;
+            mEquationType[equation] = type;
         }
 
-        auto& operator=(CoefficientInfo&& other) noexcept
+        int negativeRhs(int equation) const
         {
-            mCount = other.mCount;
-            other.mCount = nullptr;
-            mNlFlags = other.mNlFlags;
-            other.mNlFlags = nullptr;
-            mColumnCount = other.mColumnCount;
-            other.mColumnCount = 0;
-            mRowCount = other.mRowCount;
-            other.mRowCount = 0;
-            return *this;
+            return mNegativeRhs[equation];
+        }
+
+        int positiveRhs(int equation) const
+        {
+            return mPositiveRhs[equation];
+        }
+
+        void addRhs(int equation, double rhs)
+        {
+            if (rhs < 0)
+                ++mNegativeRhs[equation];
+            else if (rhs > 0)
+                ++mPositiveRhs[equation];
         }
 
     private:
-        int mRowCount = 0;
-        int mColumnCount = 0;
-        int** mCount = nullptr;
-        int** mNlFlags = nullptr;
+        int mVariableCount;
+        QVector<int> mBlockRowPtr;
+        QVector<int> mBlockColumns;
+        QVector<int> mNegativeCount;
+        QVector<int> mPositiveCount;
+        QVector<NlFlags::Word> mNlFlags;
+        QVector<int> mEquationType;
+        QVector<int> mNegativeRhs;
+        QVector<int> mPositiveRhs;
     };
 
     DataHandler(AbstractModelInstance& modelInstance);
 
     ~DataHandler();
 
-    void aggregate(const QSharedPointer<AbstractViewConfiguration> &viewConfig);
-
     void loadData(const QSharedPointer<AbstractViewConfiguration> &viewConfig);
 
+    ///
+    /// \brief Applies the current value filter of <c>viewConfig</c> to the
+    ///        loaded data, which is only loaded again if the identifier
+    ///        filter or the aggregation changed the visible sections.
+    /// \return <c>true</c> if the data was loaded again.
+    ///
+    bool updateData(const QSharedPointer<AbstractViewConfiguration> &viewConfig);
+
     QVariant data(int row, int column, int viewId) const;
 
+    ///
+    /// \brief Typed variant of data(), where empty cells are invalid.
+    ///
+    NumericValue numericData(int row, int column, int viewId) const;
+
     int nlFlag(int row, int column, int viewId);
 
     QSharedPointer<PostoptTreeItem> dataTree(int viewId) const;
@@ -180,6 +251,12 @@ public:
 
     int headerData(int logicalIndex, Qt::Orientation orientation, int viewId) const;
 
+    ///
+    /// \brief Logical indices of <c>viewId</c> which show the Jacobian
+    ///        <c>section</c>, i.e. the inverse of headerData().
+    ///
+    QList<int> logicalIndices(int section, Qt::Orientation orientation, int viewId) const;
+
     QVariant plainHeaderData(Qt::Orientation orientation,
                              int viewId, int logicalIndex,
                              int dimension) const;
@@ -207,12 +284,35 @@ public:
 
     int maxSymbolDimension(int viewId, Qt::Orientation orientation);
 
+    ///
+    /// \brief Copies the data of <c>viewId</c> to <c>newView</c>.
+    /// \remark The providers use implicitly shared buffers, i.e. both views
+    ///         share the loaded data until one of them is changed.
+    ///
     QSharedPointer<AbstractViewConfiguration> clone(int viewId, int newView);
-    
+
+    ///
+    /// \brief Loads the Jacobian and the lookup tables of the rows and
+    ///        columns, which are shared by all data providers.
+    ///
     void loadJacobian();
 
 private:
     AbstractDataProvider *cloneProvider(int viewId);
+
+    ///
+    /// \brief Coefficient info of the loaded Jacobian, which is created by
+    ///        the first block pattern view after each loadJacobian().
+    ///
+    QSharedPointer<const CoefficientInfo> coefficientInfo();
+
+    ///
+    /// \brief Checks if <c>provider</c> was created for <c>viewConfig</c>
+    ///        and is of the class newProvider() would create for it now.
+    ///
+    bool isProviderOf(const QSharedPointer<AbstractDataProvider> &provider,
+                      const QSharedPointer<AbstractViewConfiguration> &viewConfig) const;
+
     QSharedPointer<AbstractDataProvider> newProvider(const QSharedPointer<AbstractViewConfiguration> &viewConfig);
 
 private:
@@ -220,9 +320,28 @@ private:
     double mModelMinimum = std::numeric_limits<double>::max();
     double mModelMaximum = std::numeric_limits<double>::lowest();
 
-    QScopedPointer<DataMatrix> mDataMatrix;
+    ///
+    /// \brief Jacobian of the model instance, which is shared with the items
+    ///        of the postopt tree that are created on demand.
+    ///
+    QSharedPointer<DataMatrix> mDataMatrix;
     QSharedPointer<CoefficientInfo> mCoeffCount;
 
+    ///
+    /// \brief Logical variable index of each Jacobian column or -1.
+    ///
+    QVector<int> mVariableIndex;
+
+    ///
+    /// \brief Logical equation index of each Jacobian row or -1.
+    ///
+    QVector<int> mEquationIndex;
+
+    ///
+    /// \brief Right-hand side of each Jacobian row.
+    ///
+    QVector<double> mRhs;
+
     ///
     /// \brief Abstract data provider cache, where key is the view ID.
     ///
@@ -17,53 +17,16 @@ DataRow::DataRow()
 
 }
 
-DataRow::DataRow(int entries)
+DataRow::DataRow(int entries, int entriesNl, int *colIdx,
+                 double *inputData, double *outputData, NlFlags::Word *nlFlags)
     : mEntries(entries)
-    , mEntriesNl(0)
-    , mColIdx(new int[mEntries])
-    , mInputData(new double[mEntries])
-    , mOutputData(new double[mEntries])
-    , mNlFlags(new int[mEntries])
-{
-
-}
-
-DataRow::DataRow(const DataRow &other)
-    : mEntries(other.entries())
-    , mEntriesNl(other.mEntriesNl)
-    , mColIdx(new int[mEntries])
-    , mInputData(new double[mEntries])
-    , mOutputData(new double[mEntries])
-    , mNlFlags(new int[mEntries])
+    , mEntriesNl(entriesNl)
+    , mColIdx(colIdx)
+    , mInputData(inputData)
+    , mOutputData(outputData)
+    , mNlFlags(nlFlags)
 {
-    std::copy(other.mColIdx, other.mColIdx+other.mEntries, mColIdx);
-    std::copy(other.mInputData, other.mInputData+other.mEntries, mInputData);
-    std::copy(other.mOutputData, other.mOutputData+other.mEntries, mOutputData);
-    std::copy(other.mNlFlags, other.mNlFlags+other.mEntries, mNlFlags);
-}
-
-DataRow::DataRow(DataRow &&other) noexcept
-    : mEntries(other.mEntries)
-    , mEntriesNl(other.mEntriesNl)
-    , mColIdx(other.mColIdx)
-    , mInputData(other.mInputData)
-    , mOutputData(other.mOutputData)
-    , mNlFlags(other.mNlFlags)
-{
-    other.mEntries = 0;
-    other.mEntriesNl = 0;
-    other.mColIdx = nullptr;
-    other.mInputData = nullptr;
-    other.mOutputData = nullptr;
-    other.mNlFlags = nullptr;
-}
 
-DataRow::~DataRow()
-{
-    if (mColIdx) delete [] mInputData;
-    if (mOutputData) delete [] mOutputData;
-    if (mInputData) delete [] mColIdx;
-    if (mNlFlags) delete [] mNlFlags;
 }
 
 int DataRow::entries() const
@@ -71,123 +34,65 @@ int DataRow::entries() const
     return mEntries;
 }
 
-void DataRow::setEntries(int entries)
-{
-    mEntries = entries;
-}
-
 int DataRow::entriesNl() const
 {
     return mEntriesNl;
 }
 
-void DataRow::setEntriesNl(int entries)
-{
-    mEntriesNl = entries;
-}
-
 int *DataRow::colIdx() const
 {
     return mColIdx;
 }
 
-void DataRow::setColIdx(int *colIdx)
-{
-    mColIdx = colIdx;
-}
-
 double *DataRow::inputData() const
 {
     return mInputData;
 }
 
-void DataRow::setInputData(double *inputData)
-{
-    mInputData = inputData;
-}
-
 double *DataRow::outputData() const
 {
     return mOutputData ? mOutputData : mInputData;
 }
 
-void DataRow::setOutputData(double *outputData)
-{
-    mOutputData = outputData;
-}
-
-int *DataRow::nlFlags() const
+NlFlags::Word *DataRow::nlFlags() const
 {
     return mNlFlags;
 }
 
-void DataRow::setNlFlags(int *nlFlags)
+bool DataRow::nlFlag(int entry) const
 {
-    mNlFlags = nlFlags;
+    return NlFlags::test(mNlFlags, entry);
 }
 
-QVariant DataRow::inputValue(int index, int lastSymIndex)
+int DataRow::entryIndex(int index, int lastSymIndex) const
 {
     int entries = lastSymIndex < mEntries ? lastSymIndex+1 : mEntries;
-    for (int i=0; i<entries; ++i) {
-        if (mColIdx[i] == index) {
-            return mInputData[i];
-        }
-    }
-    return QVariant();
+    if (entries <= 0 || !mColIdx)
+        return -1;
+    auto end = mColIdx+entries;
+    auto iter = std::lower_bound(mColIdx, end, index);
+    return iter != end && *iter == index ? int(iter-mColIdx) : -1;
 }
 
-QVariant DataRow::outputValue(int index, int lastSymIndex)
+std::optional<double> DataRow::inputValue(int index, int lastSymIndex) const
 {
-    int entries = lastSymIndex < mEntries ? lastSymIndex+1 : mEntries;
-    for (int i=0; i<entries; ++i) {
-        if (mColIdx[i] == index) {
-            return outputData()[i];
-        }
-    }
-    return QVariant();
+    int entry = entryIndex(index, lastSymIndex);
+    if (entry < 0)
+        return std::nullopt;
+    return mInputData[entry];
 }
 
-DataRow& DataRow::operator=(const DataRow &other)
+std::optional<double> DataRow::outputValue(int index, int lastSymIndex) const
 {
-    delete [] mColIdx;
-    delete [] mInputData;
-    delete [] mOutputData;
-    delete [] mNlFlags;
-    mEntries = other.mEntries;
-    mEntriesNl = other.mEntriesNl;
-    mColIdx = new int[mEntries];
-    mInputData = new double[mEntries];
-    mOutputData = new double[mEntries];
-    mNlFlags = new int[mEntries];
-    std::copy(other.mColIdx, other.mColIdx+other.mEntries, mColIdx);
-    std::copy(other.mInputData, other.mInputData+other.mEntries, mInputData);
-    std::copy(other.mOutputData, other.mOutputData+other.mEntries, mOutputData);
-    std::copy(other.mNlFlags, other.mNlFlags+other.mEntries, mNlFlags);
-    return *this;
-}
-
-DataRow& DataRow::operator=(DataRow &&other) noexcept
-{
-    mEntries = other.mEntries;
-    mEntriesNl = other.mEntriesNl;
-    mColIdx = other.mColIdx;
-    mInputData = other.mInputData;
-    mOutputData = other.mOutputData;
-    mNlFlags = other.mNlFlags;
-    other.mEntries = 0;
-    other.mEntriesNl = 0;
-    other.mColIdx = nullptr;
-    other.mInputData = nullptr;
-    other.mOutputData = nullptr;
-    other.mNlFlags = nullptr;
-    return *this;
+    int entry = entryIndex(index, lastSymIndex);
+    if (entry < 0)
+        return std::nullopt;
+    return outputData()[entry];
 }
 
 DataMatrix::DataMatrix()
     : mRowCount(0)
     , mColumnCount(0)
-    , mRows(nullptr)
     , mEvalPoint(nullptr)
     , mModelType(0)
 {
@@ -197,41 +102,38 @@ DataMatrix::DataMatrix()
 DataMatrix::DataMatrix(int rows, int columns, int modelType)
     : mRowCount(rows)
     , mColumnCount(columns)
-    , mRows(new DataRow[mRowCount])
     , mEvalPoint(new double[columns])
     , mModelType(modelType)
+    , mRowPtr(new int[rows+1])
+    , mEntriesNl(new int[rows])
+    , mNlPtr(new int[rows+1])
 {
-
+    std::fill(mRowPtr, mRowPtr+mRowCount+1, 0);
+    std::fill(mEntriesNl, mEntriesNl+mRowCount, 0);
+    std::fill(mNlPtr, mNlPtr+mRowCount+1, 0);
 }
 
 DataMatrix::DataMatrix(const DataMatrix &other)
-    : mRowCount(other.mRowCount)
-    , mColumnCount(other.mColumnCount)
-    , mRows(new DataRow[mRowCount])
-    , mEvalPoint(new double[mColumnCount])
-    , mModelType(other.mModelType)
+    : mRowCount(0)
+    , mColumnCount(0)
+    , mEvalPoint(nullptr)
+    , mModelType(0)
 {
-    std::copy(other.mRows, other.mRows+other.mRowCount, mRows);
-    std::copy(other.mEvalPoint, other.mEvalPoint+other.mColumnCount, mEvalPoint);
+    copy(other);
 }
 
 DataMatrix::DataMatrix(DataMatrix &&other) noexcept
-    : mRowCount(other.mRowCount)
-    , mColumnCount(other.mColumnCount)
-    , mRows(other.mRows)
-    , mEvalPoint(other.mEvalPoint)
-    , mModelType(other.mModelType)
+    : mRowCount(0)
+    , mColumnCount(0)
+    , mEvalPoint(nullptr)
+    , mModelType(0)
 {
-    other.mRowCount = 0;
-    other.mColumnCount = 0;
-    other.mRows = nullptr;
-    other.mEvalPoint = nullptr;
+    move(other);
 }
 
 DataMatrix::~DataMatrix()
 {
-    if (mRows) delete[] mRows;
-    if (mEvalPoint) delete[] mEvalPoint;
+    clear();
 }
 
 int DataMatrix::rowCount() const
@@ -244,14 +146,101 @@ int DataMatrix::columnCount() const
     return mColumnCount;
 }
 
+int DataMatrix::entries() const
+{
+    return isAllocated() ? mRowPtr[mRowCount] : 0;
+}
+
 double *DataMatrix::evalPoint()
 {
     return mEvalPoint;
 }
 
-DataRow *DataMatrix::row(int row)
+void DataMatrix::setRowEntries(int row, int entries, int entriesNl)
+{
+    if (isAllocated() || row < 0 || row >= mRowCount)
+        return;
+    mRowPtr[row+1] = entries;
+    mEntriesNl[row] = entriesNl;
+}
+
+void DataMatrix::allocate()
+{
+    if (isAllocated() || !mRowPtr)
+        return;
+    clearColumnIndex();
+    for (int r=0; r<mRowCount; ++r) {
+        mNlPtr[r+1] = mNlPtr[r] + NlFlags::words(mRowPtr[r+1]);
+        mRowPtr[r+1] += mRowPtr[r];
+    }
+    int entries = mRowPtr[mRowCount];
+    mColIdx = new int[entries];
+    mInputData = new double[entries];
+    mNlFlags = new NlFlags::Word[mNlPtr[mRowCount]];
+    std::fill(mNlFlags, mNlFlags+mNlPtr[mRowCount], NlFlags::Word(0));
+    if (!isLinear()) {
+        mOutputData = new double[entries];
+    }
+}
+
+bool DataMatrix::isAllocated() const
+{
+    return mColIdx != nullptr;
+}
+
+void DataMatrix::clearRows(const QVector<int> &rows)
+{
+    if (!isAllocated() || rows.isEmpty())
+        return;
+    clearColumnIndex();
+    QVector<bool> cleared(mRowCount, false);
+    for (int row : rows) {
+        if (row >= 0 && row < mRowCount)
+            cleared[row] = true;
+    }
+    int entry = 0, word = 0;
+    for (int r=0; r<mRowCount; ++r) {
+        int first = mRowPtr[r];
+        int entries = cleared[r] ? 0 : mRowPtr[r+1] - first;
+        int firstWord = mNlPtr[r];
+        int words = cleared[r] ? 0 : mNlPtr[r+1] - firstWord;
+        if (cleared[r])
+            mEntriesNl[r] = 0;
+        if (entries && entry != first) {
+            std::copy(mColIdx+first, mColIdx+first+entries, mColIdx+entry);
+            std::copy(mInputData+first, mInputData+first+entries, mInputData+entry);
+            if (mOutputData)
+                std::copy(mOutputData+first, mOutputData+first+entries, mOutputData+entry);
+        }
+        if (words && word != firstWord)
+            std::copy(mNlFlags+firstWord, mNlFlags+firstWord+words, mNlFlags+word);
+        mRowPtr[r] = entry;
+        mNlPtr[r] = word;
+        entry += entries;
+        word += words;
+    }
+    mRowPtr[mRowCount] = entry;
+    mNlPtr[mRowCount] = word;
+}
+
+DataRow DataMatrix::row(int row) const
 {
-    return (row < 0 || row > mRowCount) ? nullptr : mRows+row;
+    if (row < 0 || row >= mRowCount || !isAllocated())
+        return DataRow();
+    int offset = mRowPtr[row];
+    return DataRow(mRowPtr[row+1] - offset, mEntriesNl[row], mColIdx+offset,
+                   mInputData+offset, mOutputData ? mOutputData+offset : nullptr,
+                   mNlFlags+mNlPtr[row]);
+}
+
+double *DataMatrix::inputData() const
+{
+    return mInputData;
+}
+
+double *DataMatrix::outputData() const
+{
+    return mOutputData ? mOutputData : mInputData;
 }
 
 bool DataMatrix::isLinear() const
@@ -259,31 +248,180 @@ bool DataMatrix::isLinear() const
     return !mModelType;
 }
 
+bool DataMatrix::hasColumnIndex() const
+{
+    return mColumnPtr != nullptr;
+}
+
+int DataMatrix::columnEntries(int column) const
+{
+    if (column < 0 || column >= mColumnCount || !mColumnPtr)
+        return 0;
+    return mColumnPtr[column+1] - mColumnPtr[column];
+}
+
+const int *DataMatrix::columnRows(int column) const
+{
+    if (column < 0 || column >= mColumnCount || !mColumnPtr)
+        return nullptr;
+    return mColumnRows + mColumnPtr[column];
+}
+
+const int *DataMatrix::columnOffsets(int column) const
+{
+    if (column < 0 || column >= mColumnCount || !mColumnPtr)
+        return nullptr;
+    return mColumnOffsets + mColumnPtr[column];
+}
+
 DataMatrix& DataMatrix::operator=(const DataMatrix &other)
 {
-    delete [] mRows;
+    if (this != &other) {
+        clear();
+        copy(other);
+    }
+    return *this;
+}
+
+DataMatrix& DataMatrix::operator=(DataMatrix &&other) noexcept
+{
+    if (this != &other) {
+        clear();
+        move(other);
+    }
+    return *this;
+}
+
+void DataMatrix::buildColumnIndex()
+{
+    clearColumnIndex();
+    if (!isAllocated())
+        return;
+    mColumnPtr = new int[mColumnCount+1];
+    std::fill(mColumnPtr, mColumnPtr+mColumnCount+1, 0);
+    int entries = this->entries();
+    for (int i=0; i<entries; ++i) {
+        int column = mColIdx[i];
+        if (column >= 0 && column < mColumnCount)
+            ++mColumnPtr[column+1];
+    }
+    for (int c=0; c<mColumnCount; ++c) {
+        mColumnPtr[c+1] += mColumnPtr[c];
+    }
+    mColumnRows = new int[mColumnPtr[mColumnCount]];
+    mColumnOffsets = new int[mColumnPtr[mColumnCount]];
+    int* next = new int[mColumnCount];
+    std::copy(mColumnPtr, mColumnPtr+mColumnCount, next);
+    for (int r=0; r<mRowCount && entries; ++r) {
+        for (int i=mRowPtr[r]; i<mRowPtr[r+1]; ++i) {
+            int column = mColIdx[i];
+            if (column < 0 || column >= mColumnCount)
+                continue;
+            int pos = next[column]++;
+            mColumnRows[pos] = r;
+            mColumnOffsets[pos] = i;
+        }
+    }
+    delete [] next;
+}
+
+void DataMatrix::clearColumnIndex()
+{
+    delete [] mColumnPtr;
+    delete [] mColumnRows;
+    delete [] mColumnOffsets;
+    mColumnPtr = nullptr;
+    mColumnRows = nullptr;
+    mColumnOffsets = nullptr;
+}
+
+void DataMatrix::clear()
+{
+    clearColumnIndex();
+    delete [] mEvalPoint;
+    delete [] mRowPtr;
+    delete [] mEntriesNl;
+    delete [] mColIdx;
+    delete [] mInputData;
+    delete [] mOutputData;
+    delete [] mNlPtr;
+    delete [] mNlFlags;
+    mRowCount = 0;
+    mColumnCount = 0;
+    mEvalPoint = nullptr;
+    mRowPtr = nullptr;
+    mEntriesNl = nullptr;
+    mColIdx = nullptr;
+    mInputData = nullptr;
+    mOutputData = nullptr;
+    mNlPtr = nullptr;
+    mNlFlags = nullptr;
+}
+
+void DataMatrix::copy(const DataMatrix &other)
+{
     mRowCount = other.mRowCount;
     mColumnCount = other.mColumnCount;
-    mRows = new DataRow[mRowCount];
-    std::copy(other.mRows, other.mRows+other.mRowCount, mRows);
-    mEvalPoint = new double[mColumnCount];
-    std::copy(other.mEvalPoint, other.mEvalPoint+other.mColumnCount, mEvalPoint);
     mModelType = other.mModelType;
-    return *this;
+    if (other.mEvalPoint) {
+        mEvalPoint = new double[mColumnCount];
+        std::copy(other.mEvalPoint, other.mEvalPoint+mColumnCount, mEvalPoint);
+    }
+    if (other.mRowPtr) {
+        mRowPtr = new int[mRowCount+1];
+        std::copy(other.mRowPtr, other.mRowPtr+mRowCount+1, mRowPtr);
+        mEntriesNl = new int[mRowCount];
+        std::copy(other.mEntriesNl, other.mEntriesNl+mRowCount, mEntriesNl);
+        mNlPtr = new int[mRowCount+1];
+        std::copy(other.mNlPtr, other.mNlPtr+mRowCount+1, mNlPtr);
+    }
+    if (other.isAllocated()) {
+        int entries = other.entries();
+        mColIdx = new int[entries];
+        std::copy(other.mColIdx, other.mColIdx+entries, mColIdx);
+        mInputData = new double[entries];
+        std::copy(other.mInputData, other.mInputData+entries, mInputData);
+        int words = other.mNlPtr[mRowCount];
+        mNlFlags = new NlFlags::Word[words];
+        std::copy(other.mNlFlags, other.mNlFlags+words, mNlFlags);
+        if (other.mOutputData) {
+            mOutputData = new double[entries];
+            std::copy(other.mOutputData, other.mOutputData+entries, mOutputData);
+        }
+        if (other.hasColumnIndex())
+            buildColumnIndex();
+    }
 }
 
-DataMatrix& DataMatrix::operator=(DataMatrix &&other) noexcept
+void DataMatrix::move(DataMatrix &other)
 {
     mRowCount = other.mRowCount;
     mColumnCount = other.mColumnCount;
-    mRows = other.mRows;
+    mModelType = other.mModelType;
     mEvalPoint = other.mEvalPoint;
+    mRowPtr = other.mRowPtr;
+    mEntriesNl = other.mEntriesNl;
+    mColIdx = other.mColIdx;
+    mInputData = other.mInputData;
+    mOutputData = other.mOutputData;
+    mNlPtr = other.mNlPtr;
+    mNlFlags = other.mNlFlags;
+    mColumnPtr = other.mColumnPtr;
+    mColumnRows = other.mColumnRows;
+    mColumnOffsets = other.mColumnOffsets;
     other.mRowCount = 0;
     other.mColumnCount = 0;
-    other.mRows = nullptr;
     other.mEvalPoint = nullptr;
-    mModelType = other.mModelType;
-    return *this;
+    other.mRowPtr = nullptr;
+    other.mEntriesNl = nullptr;
+    other.mColIdx = nullptr;
+    other.mInputData = nullptr;
+    other.mOutputData = nullptr;
+    other.mNlPtr = nullptr;
+    other.mNlFlags = nullptr;
+    other.mColumnPtr = nullptr;
+    other.mColumnRows = nullptr;
+    other.mColumnOffsets = nullptr;
 }
 
 }
@@ -1,64 +1,67 @@
 #ifndef DATAMATRIX_H
 #define DATAMATRIX_H
 
-#include <QVariant>
+#include "nlflags.h"
+
+#include <QVector>
+
+#include <optional>
 
 namespace gams {
 namespace studio {
 namespace mii {
 
+///
+/// \brief Lightweight view of a single row of the DataMatrix storage.
+/// \remark A DataRow doesn't own any data, i.e. it is only valid as long
+///         as the DataMatrix it was created from.
+///
 class DataRow
 {
 public:
     DataRow();
 
-    DataRow(int entries);
-
-    DataRow(const DataRow& other);
-
-    DataRow(DataRow&& other) noexcept;
-
-    ~DataRow();
+    DataRow(int entries, int entriesNl, int *colIdx,
+            double *inputData, double *outputData, NlFlags::Word *nlFlags);
 
     int entries() const;
 
-    void setEntries(int entries);
-
     int entriesNl() const;
 
-    void setEntriesNl(int entries);
-
     int* colIdx() const;
 
-    void setColIdx(int* colIdx);
-
     ///
     /// \brief Pointer to input data, always available.
     /// \return Pointer to input data.
     ///
     double* inputData() const;
 
-    void setInputData(double* inputData);
-
     ///
     /// \brief Pointer to output data, if available.
     /// \return Pointer to ouput data.
     ///
     double* outputData() const;
 
-    void setOutputData(double* outputData);
-
-    int* nlFlags() const;
-
-    void setNlFlags(int *nlFlags);
+    ///
+    /// \brief Bit-packed nonlinear flags, one bit per entry.
+    ///
+    NlFlags::Word* nlFlags() const;
 
-    QVariant inputValue(int index, int lastSymIndex);
+    bool nlFlag(int entry) const;
 
-    QVariant outputValue(int index, int lastSymIndex);
+    ///
+    /// \brief Position of column <c>index</c> in the row storage.
+    /// \param index Column index to look up.
+    /// \param lastSymIndex Upper bound of the entries to search.
+    /// \return Entry position or <c>-1</c> if the column has no entry.
+    /// \remark Column indices are sorted (as returned by GMO), so this is a
+    ///         binary search.
+    ///
+    int entryIndex(int index, int lastSymIndex) const;
 
-    DataRow& operator=(const DataRow& other);
+    std::optional<double> inputValue(int index, int lastSymIndex) const;
 
-    DataRow& operator=(DataRow&& other) noexcept;
+    std::optional<double> outputValue(int index, int lastSymIndex) const;
 
 private:
     int mEntries;
@@ -66,9 +69,17 @@ private:
     int* mColIdx;
     double *mInputData;
     double *mOutputData;
-    int *mNlFlags;
+    NlFlags::Word *mNlFlags;
 };
 
+///
+/// \brief Sparse row-major (CSR) matrix, where all rows share a few large
+///        contiguous arrays.
+///
+/// The matrix is set up in two steps. First the number of entries of each
+/// row is registered with setRowEntries(), then allocate() creates the
+/// storage which can be filled through the row() views.
+///
 class DataMatrix
 {
 public:
@@ -86,22 +97,119 @@ public:
 
     int columnCount() const;
 
+    ///
+    /// \brief Total number of nonzero entries.
+    ///
+    int entries() const;
+
     double* evalPoint();
 
-    DataRow* row(int row);
+    ///
+    /// \brief Sets the number of (nonlinear) entries of <c>row</c>.
+    /// \remark Has no effect after allocate() was called.
+    ///
+    void setRowEntries(int row, int entries, int entriesNl);
+
+    ///
+    /// \brief Allocates the storage for all entries set by setRowEntries().
+    ///
+    void allocate();
+
+    bool isAllocated() const;
+
+    ///
+    /// \brief Removes all entries of the given <c>rows</c>, e.g. rows which
+    ///        couldn't be loaded.
+    /// \remark The remaining entries are moved to the front of the storage,
+    ///         i.e. the row views taken before are invalid afterwards.
+    ///
+    void clearRows(const QVector<int> &rows);
+
+    ///
+    /// \brief View of the given <c>row</c>.
+    /// \return The row view, which is empty if <c>row</c> is out of range
+    ///         or the storage is not allocated.
+    ///
+    DataRow row(int row) const;
+
+    ///
+    /// \brief Pointer to the input data of all entries.
+    ///
+    double* inputData() const;
+
+    ///
+    /// \brief Pointer to the output data of all entries, if available.
+    /// \return Pointer to ouput data or input data for linear models.
+    ///
+    double* outputData() const;
 
     bool isLinear() const;
 
+    ///
+    /// \brief Builds the column-major (CSC) index of the row storage.
+    /// \remark Has to be called once the column indices of all rows are set,
+    ///         and again if they are changed through the row() views. The
+    ///         index is read-only afterwards, i.e. the column accessors can be
+    ///         used concurrently.
+    ///
+    void buildColumnIndex();
+
+    bool hasColumnIndex() const;
+
+    ///
+    /// \brief Number of nonzero entries of <c>column</c>.
+    /// \return The number of entries or 0 if the column index is not built.
+    ///
+    int columnEntries(int column) const;
+
+    ///
+    /// \brief Row indices of all nonzero entries of <c>column</c>.
+    /// \return Pointer to <c>columnEntries(column)</c> ascending row indices
+    ///         or <c>nullptr</c> if the column index is not built.
+    ///
+    const int* columnRows(int column) const;
+
+    ///
+    /// \brief Entry offsets of all nonzero entries of <c>column</c>.
+    /// \return Pointer to <c>columnEntries(column)</c> offsets into the matrix
+    ///         storage, e.g. <c>inputData()[columnOffsets(column)[i]]</c>, or
+    ///         <c>nullptr</c> if the column index is not built.
+    ///
+    const int* columnOffsets(int column) const;
+
     DataMatrix& operator=(const DataMatrix& other);
 
     DataMatrix& operator=(DataMatrix&& other) noexcept;
 
+private:
+    void clearColumnIndex();
+
+    void clear();
+
+    void copy(const DataMatrix& other);
+
+    void move(DataMatrix& other);
+
 private:
     int mRowCount;
     int mColumnCount;
-    DataRow *mRows;
     double *mEvalPoint;
     int mModelType;
+
+    // row storage (CSR), where mRowPtr holds the row entries until allocate()
+    int *mRowPtr = nullptr;
+    int *mEntriesNl = nullptr;
+    int *mColIdx = nullptr;
+    double *mInputData = nullptr;
+    double *mOutputData = nullptr;
+    // bit-packed NL flags, where each row starts at the word mNlPtr[row]
+    int *mNlPtr = nullptr;
+    NlFlags::Word *mNlFlags = nullptr;
+
+    // column-major (CSC) index of the row storage, see buildColumnIndex()
+    int *mColumnPtr = nullptr;
+    int *mColumnRows = nullptr;
+    int *mColumnOffsets = nullptr;
 };
 
 }
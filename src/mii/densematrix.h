@@ -0,0 +1,188 @@
+/**
+ * GAMS Model Instance Inspector (MII)
+ *
+ * Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef DENSEMATRIX_H
+#define DENSEMATRIX_H
+
+#include <algorithm>
+#include <memory>
+
+namespace gams {
+namespace studio {
+namespace mii {
+
+///
+/// \brief Dense row-major matrix stored in one contiguous buffer, e.g. used
+///        for the cells of the block pattern views and the nonlinear flags.
+/// \remark Copies share the buffer until one of them is changed
+///         (copy-on-write). Writes go through cells() or data(), which
+///         detach the matrix once, i.e. not per cell.
+///
+template<typename T>
+class DenseMatrix
+{
+public:
+    ///
+    /// \brief Writable cells of a detached matrix.
+    /// \remark The cells are valid until the matrix is copied, assigned or
+    ///         destroyed.
+    ///
+    class Cells
+    {
+    public:
+        inline T* operator[](int row) const
+        {
+            return mData + row*mColumnCount;
+        }
+
+    private:
+        friend class DenseMatrix;
+
+        Cells(T *data, int columnCount)
+            : mData(data)
+            , mColumnCount(columnCount)
+        {
+
+        }
+
+    private:
+        T *mData;
+        int mColumnCount;
+    };
+
+    DenseMatrix()
+    {
+
+    }
+
+    DenseMatrix(int rowCount, int columnCount, const T &value = T())
+        : mRowCount(rowCount)
+        , mColumnCount(columnCount)
+        , mData(new T[size()])
+    {
+        std::fill(mData.get(), mData.get()+size(), value);
+    }
+
+    DenseMatrix(const DenseMatrix &other) = default;
+
+    DenseMatrix(DenseMatrix &&other) noexcept
+        : mRowCount(other.mRowCount)
+        , mColumnCount(other.mColumnCount)
+        , mData(std::move(other.mData))
+    {
+        other.mRowCount = 0;
+        other.mColumnCount = 0;
+    }
+
+    int rowCount() const
+    {
+        return mRowCount;
+    }
+
+    int columnCount() const
+    {
+        return mColumnCount;
+    }
+
+    int size() const
+    {
+        return mRowCount * mColumnCount;
+    }
+
+    ///
+    /// \brief Checks if the buffer is shared with another matrix.
+    ///
+    bool isShared() const
+    {
+        return mData.use_count() > 1;
+    }
+
+    inline const T* data() const
+    {
+        return mData.get();
+    }
+
+    inline T* data()
+    {
+        detach();
+        return mData.get();
+    }
+
+    ///
+    /// \brief First cell of <c>row</c>, i.e. <c>matrix[row][column]</c>.
+    ///
+    inline const T* operator[](int row) const
+    {
+        return mData.get() + row*mColumnCount;
+    }
+
+    ///
+    /// \brief Detaches the matrix and returns its writable cells.
+    ///
+    Cells cells()
+    {
+        detach();
+        return Cells(mData.get(), mColumnCount);
+    }
+
+    void fill(const T &value)
+    {
+        auto first = data();
+        std::fill(first, first+size(), value);
+    }
+
+    DenseMatrix& operator=(const DenseMatrix &other) = default;
+
+    DenseMatrix& operator=(DenseMatrix &&other) noexcept
+    {
+        if (this == &other)
+            return *this;
+        mRowCount = other.mRowCount;
+        mColumnCount = other.mColumnCount;
+        mData = std::move(other.mData);
+        other.mRowCount = 0;
+        other.mColumnCount = 0;
+        return *this;
+    }
+
+private:
+    ///
+    /// \brief Creates an own copy of the buffer if it is shared.
+    ///
+    void detach()
+    {
+        if (!isShared())
+            return;
+        std::shared_ptr<T[]> data(new T[size()]);
+        std::copy(mData.get(), mData.get()+size(), data.get());
+        mData = std::move(data);
+    }
+
+private:
+    int mRowCount = 0;
+    int mColumnCount = 0;
+    std::shared_ptr<T[]> mData;
+};
+
+}
+}
+}
+
+#endif // DENSEMATRIX_H
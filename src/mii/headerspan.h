@@ -0,0 +1,94 @@
+/**
+ * GAMS Model Instance Inspector (MII)
+ *
+ * Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef HEADERSPAN_H
+#define HEADERSPAN_H
+
+#include <QVector>
+
+namespace gams {
+namespace studio {
+namespace mii {
+
+///
+/// \brief Cell of the header span table.
+///
+struct HeaderSpan
+{
+    ///
+    /// \brief Number of sections covered by the cell, where 0 means the
+    ///        cell is merged into the cell of a previous section.
+    ///
+    int Span;
+
+    ///
+    /// \brief UEL index of the label or the first section of the symbol
+    ///        for the symbol cell; 0 if not available.
+    ///
+    int Label;
+};
+
+///
+/// \brief Run-length merge of the header cells, which is independent of the
+///        header view.
+///
+class HeaderSpans
+{
+public:
+    ///
+    /// \brief Sets the spans of all cells of <c>spans</c>.
+    /// \param spans Span table with <c>stride</c> cells per section, where
+    ///        the first cell is the symbol cell. The labels have to be set.
+    /// \param symbols Symbol of each section, e.g. its first section, or -1
+    ///        if the section has no symbol.
+    /// \remark A cell is merged if the previous section belongs to the same
+    ///         symbol and shares the label of the cell and its parent
+    ///         dimension.
+    ///
+    static void merge(QVector<HeaderSpan> &spans, const QVector<int> &symbols, int stride)
+    {
+        QVector<int> runStart(stride, -1);
+        int prevSymbol = -1;
+        for (int section=0; section<symbols.size(); ++section) {
+            bool sameSymbol = symbols[section] >= 0 && symbols[section] == prevSymbol;
+            auto cells = spans.data() + section*stride;
+            auto prevCells = cells - stride;
+            for (int c=0; c<stride; ++c) {
+                bool merged = sameSymbol && runStart[c] >= 0 &&
+                        (c == 0 || (cells[c].Label == prevCells[c].Label &&
+                                    (c == 1 || cells[c-1].Label == prevCells[c-1].Label)));
+                if (merged) {
+                    cells[c].Span = 0;
+                    ++spans[runStart[c]*stride + c].Span;
+                } else {
+                    cells[c].Span = 1;
+                    runStart[c] = section;
+                }
+            }
+            prevSymbol = symbols[section];
+        }
+    }
+};
+
+}
+}
+}
+
+#endif // HEADERSPAN_H
@@ -22,9 +22,13 @@
 #include "filtertreeitem.h"
 #include "labelfilterwidget.h"
 #include "abstractmodelinstance.h"
+#include "headerspan.h"
+#include "labelfiltertree.h"
 
+#include <QHash>
 #include <QPainter>
 #include <QPointer>
+#include <QSet>
 #include <QMenu>
 #include <QMouseEvent>
 #include <QWidgetAction>
@@ -35,7 +39,7 @@ namespace gams {
 namespace studio{
 namespace mii {
 
-typedef QMap<Qt::Orientation, QMap<int, QVector<int>>> IdentifierLabelSections;
+typedef QMap<Qt::Orientation, QMap<int, QSet<int>>> IdentifierLabelSections;
 
 class HierarchicalHeaderView::HierarchicalHeaderView_private
 {
@@ -66,6 +70,10 @@ public:
     {
         QFontMetrics fm(mHeaderView->font());
         auto flags = Qt::TextSingleLine | Qt::TextDontClip;
+        mMetricsFont = mHeaderView->font();
+        mCellSizes.clear();
+        mLabelWidths.clear();
+        mLabelExtents.clear();
         mMinCellSize = symbolTextSize();
         mEmptyTextSize = fm.size(flags, "");
         mFilterIconSize = QSize(mEmptyTextSize.height(), mEmptyTextSize.height());
@@ -111,6 +119,108 @@ public:
         return symbol(sectionIndex)->dimension();
     }
 
+    ///
+    /// \brief Drops the span table, which is rebuilt on the next paint.
+    ///
+    void invalidateSpans()
+    {
+        mSpansValid = false;
+        mLabelExtents.clear();
+    }
+
+    ///
+    /// \brief Drops the cached text metrics if the font has changed, e.g.
+    ///        after a zoom.
+    ///
+    void updateMetrics()
+    {
+        if (mMetricsFont != mHeaderView->font())
+            init();
+    }
+
+    ///
+    /// \brief Maximum text width of the labels of <c>dimension</c> of all
+    ///        sections.
+    /// \remark Only the distinct labels are measured, because the widths
+    ///         are cached per UEL index. The extent is kept until the section
+    ///         mapping or the font changes.
+    ///
+    int labelExtent(int dimension)
+    {
+        updateMetrics();
+        updateSpans();
+        int cell = dimension + 1;
+        if (dimension < 0 || cell >= mSpanStride)
+            return 0;
+        if (mLabelExtents.size() != mSpanStride)
+            mLabelExtents.fill(-1, mSpanStride);
+        if (mLabelExtents[cell] >= 0)
+            return mLabelExtents[cell];
+        int extent = 0;
+        for (int logicalIndex=0; logicalIndex<mSpanSections.size(); ++logicalIndex) {
+            const auto &span = mSpans[logicalIndex*mSpanStride + cell];
+            if (span.Span && span.Label > 0) {
+                extent = qMax(extent, labelWidth(span.Label,
+                                                 mSpanSections[logicalIndex],
+                                                 dimension));
+            }
+        }
+        mLabelExtents[cell] = extent;
+        return extent;
+    }
+
+    ///
+    /// \brief Size of the section <c>logicalIndex</c>, where the label cells
+    ///        of standard views are widened to their labels.
+    ///
+    QSize sectionSize(int logicalIndex, const QStyleOptionHeader &option)
+    {
+        QSize cell(cellSize(option));
+        QSize size(cell);
+        int dimension = maxSymbolDimension(mHeaderView->orientation());
+        if (mHeaderView->orientation() == Qt::Horizontal) {
+            size.rheight() += dimension * cell.height();
+            if (ViewHelper::isStandardView(mHeaderView->viewType())) {
+                int sectionIdx = spanSectionIndex(logicalIndex);
+                for (int d=0; d<dimension; ++d) {
+                    int width = labelWidth(span(logicalIndex, d).Label, sectionIdx, d);
+                    size.rwidth() = qMax(size.width(), cell.width() + width - mMinCellSize.width());
+                }
+            }
+        } else {
+            for (int d=0; d<dimension; ++d) {
+                size.rwidth() += dimensionWidth(option, d);
+            }
+        }
+        return size;
+    }
+
+    ///
+    /// \brief Section index of <c>logicalIndex</c> taken from the span table.
+    ///
+    int spanSectionIndex(int logicalIndex)
+    {
+        updateSpans();
+        if (logicalIndex < 0 || logicalIndex >= mSpanSections.size())
+            return sectionIndex(logicalIndex);
+        return mSpanSections[logicalIndex];
+    }
+
+    ///
+    /// \brief Span cell of <c>logicalIndex</c> and <c>dimension</c>, where
+    ///        the dimension -1 is the symbol cell.
+    ///
+    const HeaderSpan& span(int logicalIndex, int dimension)
+    {
+        static const HeaderSpan Unmerged { 1, 0 };
+        updateSpans();
+        int cell = dimension + 1;
+        if (logicalIndex < 0 || logicalIndex >= mSpanSections.size() ||
+                cell < 0 || cell >= mSpanStride)
+            return Unmerged;
+        return mSpans[logicalIndex*mSpanStride + cell];
+    }
+
     void paintHorizontalSection(QPainter *painter,
                                 const QRect &rect,
                                 const QStyleOptionHeader &option,
@@ -128,13 +238,13 @@ public:
         }
 
         paintHorizontalCell(painter, rect, styleOption, currentTop,
-                            label(sectionIndex, -1, mHeaderView->orientation()),
-                            logicalIndex, sectionIndex, -1, true);
+                            cellText(logicalIndex, sectionIndex, -1),
+                            sectionIndex, true);
         if (ViewHelper::isStandardView(mHeaderView->viewType())) {
             for (int d=0; d<horizontalSectionDimension(sectionIndex); ++d) {
                 paintHorizontalCell(painter, rect, styleOption, currentTop,
-                                    label(sectionIndex, d, mHeaderView->orientation()),
-                                    logicalIndex, sectionIndex, d, false);
+                                    cellText(logicalIndex, sectionIndex, d),
+                                    sectionIndex, false);
             }
             paintHorizontalCellSpacing(painter, rect, styleOption, currentTop, sectionIndex);
         }
@@ -147,16 +257,13 @@ public:
                              const QStyleOptionHeader &option,
                              int &currentTop,
                              const QString &text,
-                             int logicalIndex,
                              int sectionIndex,
-                             int dimension,
                              bool isSymbol)
     {
         QStyleOptionHeader styleOption(option);
         QSize size = cellSize(styleOption);
         styleOption.rect = QRect(rect.x(), currentTop, rect.width(), size.height());
-        auto currentSym = symbol(sectionIndex);
-        styleOption.text = horizontalCellText(logicalIndex, sectionIndex, dimension, isSymbol, currentSym, text);
+        styleOption.text = text;
 
         painter->save();
         if (isSymbol && ViewHelper::isStandardView(mHeaderView->viewType())) {
@@ -212,12 +319,12 @@ public:
         }
 
         paintVerticalCell(painter, rect, styleOption, currentLeft,
-                          label(sectionIndex, -1, mHeaderView->orientation()),
-                          logicalIndex, sectionIndex, -1, true);
+                          cellText(logicalIndex, sectionIndex, -1),
+                          sectionIndex, -1);
         for (int d=0; d<verticalSectionDimension(sectionIndex); ++d) {
             paintVerticalCell(painter, rect, styleOption, currentLeft,
-                              label(sectionIndex, d, mHeaderView->orientation()),
-                              logicalIndex, sectionIndex, d, false);
+                              cellText(logicalIndex, sectionIndex, d),
+                              sectionIndex, d);
         }
         paintVerticalCellSpacing(painter, rect, styleOption, currentLeft, sectionIndex);
 
@@ -229,16 +336,14 @@ public:
                            const QStyleOptionHeader &option,
                            int &currentLeft,
                            const QString &text,
-                           int logicalIndex,
                            int sectionIndex,
-                           int dimension,
-                           bool isSymbol)
+                           int dimension)
     {
         QStyleOptionHeader styleOption(option);
-        QSize size = cellSize(styleOption);
+        QSize size(dimensionWidth(styleOption, dimension), 0);
+        bool isSymbol = dimension < 0;
         styleOption.rect = QRect(currentLeft, rect.y(), size.width(), rect.height());
-        auto currentSym = symbol(sectionIndex);
-        styleOption.text = verticalCellText(logicalIndex, sectionIndex, dimension, isSymbol, currentSym, text);
+        styleOption.text = text;
 
         painter->save();
         if (isSymbol && ViewHelper::isStandardView(mHeaderView->viewType())) {
@@ -277,97 +382,88 @@ public:
         painter->restore();
     }
 
-    QString horizontalCellText(int logicalIndex, int sectionIndex, int dimension,
-                               bool isSymbol, const Symbol *symbol,
-                               const QString &text)
-    {// TODO header drawing rules... simplify and no on the fly stuff
-        if (isSymbol && logicalIndex > 0) {
-            int prevSectionIdx = this->sectionIndex(logicalIndex-1);
-            if (symbol && symbol->contains(prevSectionIdx))
-                return QString();
-        } else if (logicalIndex > 0) {
-            int prevSectionIdx = this->sectionIndex(logicalIndex-1);
-            if (symbol && symbol->contains(prevSectionIdx) &&
-                    symbol->label(sectionIndex, dimension) == symbol->label(prevSectionIdx, dimension) &&
-                        (dimension == 0 ||
-                            symbol->label(sectionIndex, dimension-1) == symbol->label(prevSectionIdx, dimension-1))) {
-                    return QString();
-            }
-        }
-        return text;
-    }
-
-    QString verticalCellText(int logicalIndex, int sectionIndex, int dimension,
-                             bool isSymbol, const Symbol *symbol,
-                             const QString &text)
-    {// TODO header drawing rules... simplify and no on the fly stuff
-        if (!ViewHelper::isStandardView(mHeaderView->viewType())) {
+    ///
+    /// \brief Text of a header cell, which is empty if the cell is merged
+    ///        into the cell of a previous section.
+    ///
+    QString cellText(int logicalIndex, int sectionIndex, int dimension)
+    {
+        if (mHeaderView->orientation() == Qt::Vertical &&
+                !ViewHelper::isStandardView(mHeaderView->viewType())) {
             return mHeaderView->modelInstance()->plainHeaderData(mHeaderView->orientation(),
                                                                  mHeaderView->view(),
                                                                  sectionIndex,
                                                                  dimension < 0 ? 0 : dimension+1).toString();
         }
-        if (isSymbol && logicalIndex > 0) {
-            int prevSectionIdx = this->sectionIndex(logicalIndex-1);
-            if (symbol && symbol->contains(prevSectionIdx))
-                return QString();
-        } else if (logicalIndex > 0) {
-            int prevSectionIdx = this->sectionIndex(logicalIndex-1);
-            if (symbol && symbol->contains(prevSectionIdx) &&
-                    symbol->label(sectionIndex, dimension) == symbol->label(prevSectionIdx, dimension) &&
-                        (dimension == 0 ||
-                            symbol->label(sectionIndex, dimension-1) == symbol->label(prevSectionIdx, dimension-1))) {
-                    return QString();
-            }
-        }
-        return text;
+        if (!span(logicalIndex, dimension).Span)
+            return QString();
+        return label(sectionIndex, dimension, mHeaderView->orientation());
     }
 
-    QSize cellSize(QStyleOptionHeader styleOption) const
+    ///
+    /// \brief Size of an empty cell with the decorations of <c>styleOption</c>.
+    /// \remark The sizes are cached per style option properties that change
+    ///         the decorations, e.g. the sort indicator or the position.
+    ///
+    QSize cellSize(const QStyleOptionHeader &styleOption)
     {
+        updateMetrics();
+        int key = cellSizeKey(styleOption);
+        auto iter = mCellSizes.constFind(key);
+        if (iter != mCellSizes.constEnd())
+            return *iter;
         QSize decorationsSize(mHeaderView->style()->sizeFromContents(QStyle::CT_HeaderSection,
                                                                      &styleOption,
                                                                      QSize(),
                                                                      mHeaderView));
-        return mMinCellSize + decorationsSize + mIconWidth - mEmptyTextSize;
+        QSize size = mMinCellSize + decorationsSize + mIconWidth - mEmptyTextSize;
+        mCellSizes.insert(key, size);
+        return size;
     }
 
-    FilterTreeItem* filterTree(int logicalIndex, int sectionIdx, const Symbol *symbol)
+    static int cellSizeKey(const QStyleOptionHeader &styleOption)
+    {
+        int key = styleOption.position;
+        key = key << 2 | styleOption.selectedPosition;
+        key = key << 2 | styleOption.sortIndicator;
+        key = key << 1 | (styleOption.state & QStyle::State_On ? 1 : 0);
+        key = key << 1 | (styleOption.state & QStyle::State_Sunken ? 1 : 0);
+        return key;
+    }
+
+    ///
+    /// \brief Width of the vertical header cells of <c>dimension</c>, where
+    ///        the dimension -1 is the symbol cell.
+    ///
+    int dimensionWidth(const QStyleOptionHeader &styleOption, int dimension)
     {
-        auto root = new FilterTreeItem;
-        root->setCheckable(false);
-        root->setSymbolIndex(symbol->firstSection());
-        root->setSectionIndex(symbol->firstSection());
-        root->setText(symbol->name());
+        int width = cellSize(styleOption).width();
+        if (dimension < 0 || !ViewHelper::isStandardView(mHeaderView->viewType()))
+            return width;
+        return width + qMax(0, labelExtent(dimension) - mMinCellSize.width());
+    }
 
-        QVector<int> visibleSections = visibleLabelSections(logicalIndex, sectionIdx, symbol);
+    ///
+    /// \brief Text width of the label <c>uel</c> in the current font.
+    ///
+    int labelWidth(int uel, int sectionIndex, int dimension)
+    {
+        if (uel <= 0)
+            return 0;
+        auto iter = mLabelWidths.constFind(uel);
+        if (iter != mLabelWidths.constEnd())
+            return *iter;
+        QFontMetrics fm(mHeaderView->font());
+        int width = fm.horizontalAdvance(label(sectionIndex, dimension, mHeaderView->orientation()));
+        mLabelWidths.insert(uel, width);
+        return width;
+    }
 
-        QString label;
-        QMap<int, QStringList> subData;
-        auto filter = identifierState(symbol->firstSection(), mHeaderView->orientation());
-        for (int section=symbol->firstSection(); section<=symbol->lastSection(); ++section) {
-            if (symbol->sectionLabels().isEmpty()) {
-                continue;
-            }
-            auto subLabels = symbol->sectionLabels()[section];
-            if (symbol->sectionLabels()[section].isEmpty()) {
-                continue;
-            }
-            if (label.isEmpty()) {
-                label = subLabels.takeFirst();
-                subData[section] = subLabels;
-            } else if (label == symbol->sectionLabels()[section].first()) {
-                subLabels.removeFirst();
-                subData[section] = subLabels;
-            } else {
-                labelFilterTree(label, subData, filter, visibleSections, symbol->firstSection(), root);
-                label = subLabels.takeFirst();
-                subData.clear();
-                subData[section] = subLabels;
-            }
-        }
-        labelFilterTree(label, subData, filter, visibleSections, symbol->firstSection(), root);
-        return root;
+    FilterTreeItem* filterTree(int logicalIndex, int sectionIdx, const Symbol *symbol)
+    {
+        return LabelFilterTree::create(symbol,
+                                       identifierState(symbol->firstSection(), mHeaderView->orientation()),
+                                       visibleLabelSections(logicalIndex, sectionIdx, symbol));
     }
 
     int maxSymbolDimension(Qt::Orientation orientation)
@@ -445,68 +541,55 @@ private:
         return fm.size(flags, "aaaaaaaa"); // TODO !!! fix header space issue
     }
 
-    QVector<int> visibleLabelSections(int logicalIndex, int sectionIdx, const Symbol *symbol)
+    ///
+    /// \brief Builds the span table of all logical sections if it is not
+    ///        valid, i.e. the merge decisions of the header cells.
+    /// \remark The labels are compared by their UEL index, see
+    ///         HeaderSpans::merge.
+    ///
+    void updateSpans()
     {
-        if (mVisibleLabelSections[mHeaderView->orientation()].contains(symbol->firstSection())) {
-            return mVisibleLabelSections[mHeaderView->orientation()][symbol->firstSection()];
+        if (mSpansValid)
+            return;
+        mSpansValid = true;
+        auto model = mHeaderView->model();
+        int count = !model ? 0 : mHeaderView->orientation() == Qt::Horizontal ? model->columnCount()
+                                                                              : model->rowCount();
+        mSpanStride = qMax(maximumSymbolDimension(), 1) + 1;
+        mSpanSections.resize(count);
+        mSpans.resize(count*mSpanStride);
+        QVector<int> symbols(count, -1);
+        for (int logicalIndex=0; logicalIndex<count; ++logicalIndex) {
+            int sectionIdx = sectionIndex(logicalIndex);
+            mSpanSections[logicalIndex] = sectionIdx;
+            auto symbol = sectionIdx < 0 ? nullptr : this->symbol(sectionIdx);
+            auto cells = mSpans.data() + logicalIndex*mSpanStride;
+            cells[0].Label = symbol ? symbol->firstSection() : 0;
+            for (int c=1; c<mSpanStride; ++c) {
+                cells[c].Label = symbol ? symbol->labelIndex(sectionIdx, c-1) : 0;
+            }
+            if (symbol)
+                symbols[logicalIndex] = symbol->firstSection();
         }
-        QVector<int> visibleSections;
+        HeaderSpans::merge(mSpans, symbols, mSpanStride);
+    }
+
+    const QSet<int>& visibleLabelSections(int logicalIndex, int sectionIdx, const Symbol *symbol)
+    {
+        auto &sections = mVisibleLabelSections[mHeaderView->orientation()];
+        auto iter = sections.find(symbol->firstSection());
+        if (iter != sections.end())
+            return *iter;
+        QSet<int> visibleSections;
+        visibleSections.reserve(symbol->entries());
         int logicalEnd = logicalIndex + symbol->lastSection() - sectionIdx;
         int logicalStart = logicalEnd - symbol->entries() + 1;
         for (int i=logicalStart; i<=logicalEnd; ++i) {
-            int sIndex = sectionIndex(i);
+            int sIndex = spanSectionIndex(i);
             if (symbol->contains(sIndex))
-                visibleSections.push_back(sIndex);
-        }
-        mVisibleLabelSections[mHeaderView->orientation()][symbol->firstSection()] = visibleSections;
-        return mVisibleLabelSections[mHeaderView->orientation()][symbol->firstSection()];
-    }
-
-    void labelFilterTree(const QString &label,
-                         const QMap<int, QStringList> &data,
-                         const IdentifierState &state,
-                         const QVector<int> &visibleSections,
-                         int symbolIndex,
-                         FilterTreeItem *parent)
-    {
-        if (data.isEmpty() || label.isEmpty()) return;
-        FilterTreeItem *labelItem = nullptr;
-        bool enabled = parent->parent() ? visibleSections.contains(data.firstKey()) : true;
-        if (state.isValid() && state.CheckStates.contains(data.firstKey())) {
-            labelItem = new FilterTreeItem(label,
-                                           enabled ? state.CheckStates[data.firstKey()] : Qt::Unchecked,
-                                           parent);
-            labelItem->setSectionIndex(data.firstKey());
-            labelItem->setEnabled(enabled);
-        } else {
-            labelItem = new FilterTreeItem(label, enabled ? Qt::Checked : Qt::Unchecked, parent);
-            labelItem->setSectionIndex(data.firstKey());
-            labelItem->setEnabled(enabled);
-        }
-        labelItem->setSymbolIndex(symbolIndex);
-        parent->append(labelItem);
-
-        QString subLabel;
-        QMap<int, QStringList> subData;
-        for (auto iter=data.keyValueBegin(); iter!=data.keyValueEnd(); ++iter) {
-            auto subLabels = iter->second;
-            if (subLabels.isEmpty()) {
-                continue;
-            }
-            if (subLabel.isEmpty()) {
-                subLabel = subLabels.takeFirst();
-                subData[iter->first] = subLabels;
-            } else if (subLabel == subLabels.first()) {
-                subLabels.removeFirst();
-                subData[iter->first] = subLabels;
-            } else {
-                labelFilterTree(subLabel, subData, state, visibleSections, symbolIndex, labelItem);
-                subLabel = subLabels.takeFirst();
-                subData.clear();
-                subData[iter->first] = subLabels;
-            }
+                visibleSections.insert(sIndex);
         }
-        labelFilterTree(subLabel, subData, state, visibleSections, symbolIndex, labelItem);
+        return *sections.insert(symbol->firstSection(), visibleSections);
     }
 
 private:
@@ -523,8 +606,18 @@ private:
     QPixmap mPixmapFilterOn;
     QPixmap mPixmapFilterOff;
 
+    QFont mMetricsFont;
+    QHash<int, QSize> mCellSizes;
+    QHash<int, int> mLabelWidths;
+    QVector<int> mLabelExtents;
+
     IdentifierFilter mIdentifierFilter;
     IdentifierLabelSections mVisibleLabelSections;
+
+    bool mSpansValid = false;
+    int mSpanStride = 0;
+    QVector<int> mSpanSections;
+    QVector<HeaderSpan> mSpans;
 };
 
 HierarchicalHeaderView::HierarchicalHeaderView(Qt::Orientation orientation,
@@ -571,6 +664,27 @@ void HierarchicalHeaderView::setIdentifierState(const IdentifierState &state)
 void HierarchicalHeaderView::setModel(QAbstractItemModel *model)
 {
     mPrivate->init();
+    mPrivate->invalidateSpans();
+    for (const auto &connection : std::as_const(mModelConnections))
+        disconnect(connection);
+    mModelConnections.clear();
+    if (model) {
+        // connected ahead of QHeaderView, so that the relayout of the
+        // sections sees the new section mapping
+        auto invalidateSpans = [this]{ mPrivate->invalidateSpans(); };
+        mModelConnections << connect(model, &QAbstractItemModel::modelReset, this, invalidateSpans);
+        mModelConnections << connect(model, &QAbstractItemModel::layoutChanged, this, invalidateSpans);
+        mModelConnections << connect(model, &QAbstractItemModel::headerDataChanged, this, invalidateSpans);
+        if (orientation() == Qt::Horizontal) {
+            mModelConnections << connect(model, &QAbstractItemModel::columnsInserted, this, invalidateSpans);
+            mModelConnections << connect(model, &QAbstractItemModel::columnsRemoved, this, invalidateSpans);
+            mModelConnections << connect(model, &QAbstractItemModel::columnsMoved, this, invalidateSpans);
+        } else {
+            mModelConnections << connect(model, &QAbstractItemModel::rowsInserted, this, invalidateSpans);
+            mModelConnections << connect(model, &QAbstractItemModel::rowsRemoved, this, invalidateSpans);
+            mModelConnections << connect(model, &QAbstractItemModel::rowsMoved, this, invalidateSpans);
+        }
+    }
     QHeaderView::setModel(model);
 }
 
@@ -584,6 +698,11 @@ void HierarchicalHeaderView::setViewType(ViewHelper::ViewDataType viewType)
     mViewType = viewType;
 }
 
+int HierarchicalHeaderView::labelExtent(int dimension) const
+{
+    return mPrivate->labelExtent(dimension);
+}
+
 int HierarchicalHeaderView::view() const
 {
     return mView;
@@ -629,7 +748,7 @@ void HierarchicalHeaderView::paintSection(QPainter *painter,
 {
     if (rect.isValid()) {
         auto option = styleOptionForCell(logicalIndex);
-        int sectionIdx = mPrivate->sectionIndex(logicalIndex);
+        int sectionIdx = mPrivate->spanSectionIndex(logicalIndex);
         if (sectionIdx < 0 ) return;
         if (orientation() == Qt::Horizontal) {
             mPrivate->paintHorizontalSection(painter, rect, option, logicalIndex, sectionIdx);
@@ -643,18 +762,14 @@ void HierarchicalHeaderView::paintSection(QPainter *painter,
 
 QSize HierarchicalHeaderView::sectionSizeFromContents(int logicalIndex) const
 {
-    QStyleOptionHeader styleOption(styleOptionForCell(logicalIndex));
-    QSize size(mPrivate->cellSize(styleOption));
+    return mPrivate->sectionSize(logicalIndex, styleOptionForCell(logicalIndex));
+}
 
-    int dimension = mPrivate->maxSymbolDimension(orientation());
-    for (int d=0; d<dimension; ++d) {
-        if (orientation() == Qt::Horizontal) {
-            size.rheight() += mPrivate->cellSize(styleOption).height();
-        } else {
-            size.rwidth() += mPrivate->cellSize(styleOption).width();
-        }
-    }
-    return size;
+void HierarchicalHeaderView::changeEvent(QEvent *event)
+{
+    if (event->type() == QEvent::FontChange || event->type() == QEvent::StyleChange)
+        mPrivate->init();
+    QHeaderView::changeEvent(event);
 }
 
 void HierarchicalHeaderView::mousePressEvent(QMouseEvent *event)
@@ -78,11 +78,19 @@ protected:
 
     QSize sectionSizeFromContents(int logicalIndex) const override;
 
+    void changeEvent(QEvent *event) override;
+
     void mousePressEvent(QMouseEvent *event) override;
 
 private:
     QStyleOptionHeader styleOptionForCell(int logicalIndex) const;
 
+    ///
+    /// \brief Maximum text width of the labels of <c>dimension</c>, which
+    ///        is taken from a per font cache of the label widths.
+    ///
+    int labelExtent(int dimension) const;
+
 private:
     class HierarchicalHeaderView_private;
     HierarchicalHeaderView_private *mPrivate;
@@ -92,6 +100,12 @@ private:
 
     QMenu *mFilterMenu;
     LabelFilterWidget *mFilterWidget;
+
+    ///
+    /// \brief Span invalidations connected to the current model, which are
+    ///        dropped if the model is replaced.
+    ///
+    QVector<QMetaObject::Connection> mModelConnections;
 };
 
 }
@@ -0,0 +1,79 @@
+/**
+ * GAMS Model Instance Inspector (MII)
+ *
+ * Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "labelfiltertree.h"
+#include "filtertreeitem.h"
+#include "symbol.h"
+
+namespace gams {
+namespace studio {
+namespace mii {
+
+FilterTreeItem* LabelFilterTree::create(const Symbol *symbol,
+                                        const IdentifierState &filter,
+                                        const QSet<int> &visibleSections)
+{
+    auto root = new FilterTreeItem;
+    root->setCheckable(false);
+    root->setSymbolIndex(symbol->firstSection());
+    root->setSectionIndex(symbol->firstSection());
+    root->setText(symbol->name());
+
+    int dimension = symbol->dimension();
+    QVector<int> labels(dimension);
+    QVector<int> prevLabels(dimension, 0);
+    QVector<FilterTreeItem*> path(dimension, nullptr);
+    for (int section=symbol->firstSection(); section<=symbol->lastSection(); ++section) {
+        bool valid = true;
+        for (int d=0; d<dimension && valid; ++d) {
+            labels[d] = symbol->labelIndex(section, d);
+            valid = !symbol->label(section, d).isEmpty();
+        }
+        if (!valid)
+            continue;
+        int d = 0;
+        while (d < dimension && path[d] && labels[d] == prevLabels[d])
+            ++d;
+        for (; d<dimension; ++d) {
+            auto parent = d ? path[d-1] : root;
+            bool enabled = d ? visibleSections.contains(section) : true;
+            auto state = Qt::Checked;
+            if (filter.isValid()) {
+                auto iter = filter.CheckStates.constFind(section);
+                if (iter != filter.CheckStates.constEnd())
+                    state = *iter;
+            }
+            auto labelItem = new FilterTreeItem(symbol->label(section, d),
+                                                enabled ? state : Qt::Unchecked,
+                                                parent);
+            labelItem->setSectionIndex(section);
+            labelItem->setEnabled(enabled);
+            labelItem->setSymbolIndex(symbol->firstSection());
+            parent->append(labelItem);
+            path[d] = labelItem;
+            prevLabels[d] = labels[d];
+        }
+    }
+    return root;
+}
+
+}
+}
+}
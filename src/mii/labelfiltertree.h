@@ -0,0 +1,60 @@
+/**
+ * GAMS Model Instance Inspector (MII)
+ *
+ * Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef LABELFILTERTREE_H
+#define LABELFILTERTREE_H
+
+#include "common.h"
+
+#include <QSet>
+
+namespace gams {
+namespace studio {
+namespace mii {
+
+class FilterTreeItem;
+class Symbol;
+
+class LabelFilterTree
+{
+public:
+    ///
+    /// \brief Builds the label filter tree of <c>symbol</c> in a single pass
+    ///        over its sections.
+    /// \param filter Check states of the labels, keyed by the first section
+    ///        of each label item.
+    /// \param visibleSections Sections shown by the view, where the items of
+    ///        all other sections below the first dimension are disabled.
+    /// \return The root item, which is owned by the caller.
+    /// \remark The sections are in record order, i.e. sorted by their label
+    ///         tuples. Thus a new tree item is created at the first dimension
+    ///         whose UEL index differs from the previous section, which
+    ///         costs O(entries * dimension).
+    ///
+    static FilterTreeItem* create(const Symbol *symbol,
+                                  const IdentifierState &filter,
+                                  const QSet<int> &visibleSections);
+};
+
+}
+}
+}
+
+#endif // LABELFILTERTREE_H
@@ -0,0 +1,131 @@
+/**
+ * GAMS Model Instance Inspector (MII)
+ *
+ * Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef LABELSECTIONINDEX_H
+#define LABELSECTIONINDEX_H
+
+#include <QVector>
+
+#include <algorithm>
+
+#include "symbol.h"
+
+namespace gams {
+namespace studio {
+namespace mii {
+
+///
+/// \brief Inverted index of the labels, which maps each UEL index to the
+///        sorted sections of all symbols carrying the label.
+/// \remark The sections are stored in one vector, where the sections of
+///         a label are addressed by an offset vector. A section is listed
+///         once per label, even if the label appears in several dimensions.
+///
+class LabelSectionIndex
+{
+public:
+    LabelSectionIndex() = default;
+
+    ///
+    /// \brief Builds the index of all sections of <c>symbols</c>.
+    /// \param symbols Symbols in section order, e.g.
+    ///        AbstractModelInstance::equations().
+    /// \param labelCount Number of labels, i.e. the largest UEL index.
+    ///
+    void build(const QVector<Symbol*> &symbols, int labelCount)
+    {
+        mOffsets.fill(0, labelCount+2);
+        visit(symbols, labelCount, [this](int uel, int) {
+            ++mOffsets[uel+1];
+        });
+        for (int i=1; i<mOffsets.size(); ++i)
+            mOffsets[i] += mOffsets[i-1];
+        mSections.resize(mOffsets.last());
+        QVector<int> positions(mOffsets);
+        visit(symbols, labelCount, [this, &positions](int uel, int section) {
+            mSections[positions[uel]++] = section;
+        });
+    }
+
+    ///
+    /// \brief True if the index was not built yet.
+    ///
+    bool isEmpty() const
+    {
+        return mOffsets.isEmpty();
+    }
+
+    int labelCount() const
+    {
+        return std::max(0, int(mOffsets.size())-2);
+    }
+
+    ///
+    /// \brief Number of sections carrying the label <c>uel</c>.
+    ///
+    int sectionCount(int uel) const
+    {
+        if (uel < 1 || uel > labelCount())
+            return 0;
+        return mOffsets[uel+1] - mOffsets[uel];
+    }
+
+    ///
+    /// \brief Sorted sections carrying the label <c>uel</c>, where
+    ///        sectionCount() entries are valid.
+    ///
+    const int* sections(int uel) const
+    {
+        if (uel < 1 || uel > labelCount())
+            return nullptr;
+        return mSections.constData() + mOffsets[uel];
+    }
+
+private:
+    template<typename Visitor>
+    static void visit(const QVector<Symbol*> &symbols, int labelCount, Visitor visitor)
+    {
+        for (auto symbol : symbols) {
+            int dimension = symbol->dimension();
+            for (int section=symbol->firstSection(); section<=symbol->lastSection(); ++section) {
+                for (int d=0; d<dimension; ++d) {
+                    int uel = symbol->labelIndex(section, d);
+                    if (uel < 1 || uel > labelCount)
+                        continue;
+                    bool duplicate = false;
+                    for (int p=0; p<d && !duplicate; ++p)
+                        duplicate = symbol->labelIndex(section, p) == uel;
+                    if (!duplicate)
+                        visitor(uel, section);
+                }
+            }
+        }
+    }
+
+private:
+    QVector<int> mOffsets;
+    QVector<int> mSections;
+};
+
+}
+}
+}
+
+#endif // LABELSECTIONINDEX_H
@@ -254,6 +254,15 @@ void ModelInspector::updateFilters()
     }
 }
 
+void ModelInspector::updateAggregation()
+{
+    auto frame = currentView();
+    if (frame) {
+        frame->updateFilters(AbstractViewConfiguration::AggregationConfig);
+        emit filtersChanged();
+    }
+}
+
 void ModelInspector::saveModelView()
 {
     if (!ui->sectionView->viewActionStates().SaveEnabled)
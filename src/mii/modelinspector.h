@@ -91,6 +91,8 @@ public:
 
     void updateFilters();
 
+    void updateAggregation();
+
 signals:
     void filtersChanged();
 
@@ -24,7 +24,9 @@
 #include "labeltreeitem.h"
 
 #include <QAbstractItemModel>
+#include <QThread>
 #include <QVector>
+#include <QtConcurrent>
 
 #include <QDebug>
 
@@ -46,6 +48,13 @@ ModelInstance::ModelInstance(bool useOutput,
 
 ModelInstance::~ModelInstance()
 {
+    mLabelPrefetchCanceled.storeRelaxed(1);
+    mLabelPrefetch.waitForFinished();
+    if (mLabelDCT) dctFree(&mLabelDCT);
+    for (auto& handles : mWorkerHandles) {
+        if (handles.GMO) gmoFree(&handles.GMO);
+        if (handles.GEV) gevFree(&handles.GEV);
+    }
     if (mGMO) gmoFree(&mGMO);
     if (mGEV) gevFree(&mGEV);
     // don't delete mDCT... it is handled in GMO
@@ -207,59 +216,80 @@ void ModelInstance::loadScratchData()
     if (mState == Error)
         return;
     mLogMessages << "Model Workspace: " + mWorkspace;
-    QString ctrlFile = mScratchDir + "/" + FileHelper::GamsCntr;
-    mLogMessages << "CTRL File: " + ctrlFile;
-    if (gevInitEnvironmentLegacy(mGEV, ctrlFile.toStdString().c_str())) {
-        mLogMessages << "ERROR: Could not initialize model instance";
+    mLogMessages << "CTRL File: " + mScratchDir + "/" + FileHelper::GamsCntr;
+    if (mUseOutput)
+        mLogMessages << "Solution File: " + mScratchDir + "/" + FileHelper::GamsSolu;
+    if (!loadModel(mGEV, mGMO, mLogMessages)) {
         mState = Error;
         return;
     }
 
-    char msg[GMS_SSSIZE];
-    gmoRegisterEnvironment(mGMO, mGEV, msg);
-    if (gmoLoadDataLegacy(mGMO, msg)) {
-        mLogMessages << "ERROR: Could not load model instance (input): " + QString(msg);
+    mDCT = (dctHandle_t)gmoDict(mGMO);
+    if (!mDCT) {
+        mLogMessages << "ERROR: Could not load dictionary file.";
         mState = Error;
         return;
     }
 
+    mLogMessages << "Absolute Scratch Path: " + mScratchDir;
+}
+
+bool ModelInstance::loadModel(gevHandle_t gev, gmoHandle_t gmo, QStringList &messages) const
+{
+    QString ctrlFile = mScratchDir + "/" + FileHelper::GamsCntr;
+    if (gevInitEnvironmentLegacy(gev, ctrlFile.toStdString().c_str())) {
+        messages << "ERROR: Could not initialize model instance";
+        return false;
+    }
+
+    char msg[GMS_SSSIZE];
+    gmoRegisterEnvironment(gmo, gev, msg);
+    if (gmoLoadDataLegacy(gmo, msg)) {
+        messages << "ERROR: Could not load model instance (input): " + QString(msg);
+        return false;
+    }
+
     if (mUseOutput) {
         QString solFile = mScratchDir + "/" + FileHelper::GamsSolu;
-        mLogMessages << "Solution File: " + solFile;
-        gmoNameSolFileSet(mGMO, solFile.toStdString().c_str());
-        if (gmoLoadSolutionLegacy(mGMO)) {
-            mLogMessages << "ERROR: Could not load model instance (output): " + QString(msg);
-            mState = Error;
-            return;
+        gmoNameSolFileSet(gmo, solFile.toStdString().c_str());
+        if (gmoLoadSolutionLegacy(gmo)) {
+            messages << "ERROR: Could not load model instance (output): " + QString(msg);
+            return false;
         }
     }
+    return true;
+}
 
-    mDCT = (dctHandle_t)gmoDict(mGMO);
-    if (!mDCT) {
-        mLogMessages << "ERROR: Could not load dictionary file.";
-        mState = Error;
-        return;
-    }
-
-    mLogMessages << "Absolute Scratch Path: " + mScratchDir;
+void ModelInstance::setJacobianWorkers(int workers)
+{
+    mJacobianWorkers = std::max(0, workers);
 }
 
 void ModelInstance::loadEvaluationPoint(double *evalPoint, int size)
 {
-    int i = 0;
-    double value;
-    for (auto var : variables()) {
-        if (i >= size)
-            continue;
-        if (var->isScalar()) {
-            value = variableAttribute(AttributeHelper::LevelText, var->firstSection(), 0, false).toDouble();
-            evalPoint[i++] = value;
-        } else {
-            for (auto e=var->firstSection(); e<var->entries(); ++e) {
-                value = variableAttribute(AttributeHelper::LevelText, var->firstSection(), e, false).toDouble();
-                evalPoint[i++] = value;
-            }
-        }
+    auto levels = mAttributes.data(AttributeHelper::Level, Qt::Horizontal);
+    std::copy(levels, levels+std::min(size, mAttributes.size(Qt::Horizontal)), evalPoint);
+}
+
+void ModelInstance::loadAttributes()
+{
+    mAttributes.resize(equationRowCount(), variableRowCount());
+    if (gmoGetEquL(mGMO, mAttributes.data(AttributeHelper::Level, Qt::Vertical)) ||
+            gmoGetEquM(mGMO, mAttributes.data(AttributeHelper::Marginal, Qt::Vertical)) ||
+            gmoGetEquScale(mGMO, mAttributes.data(AttributeHelper::Scale, Qt::Vertical)) ||
+            gmoGetVarL(mGMO, mAttributes.data(AttributeHelper::Level, Qt::Horizontal)) ||
+            gmoGetVarM(mGMO, mAttributes.data(AttributeHelper::Marginal, Qt::Horizontal)) ||
+            gmoGetVarLower(mGMO, mAttributes.data(AttributeHelper::Lower, Qt::Horizontal)) ||
+            gmoGetVarUpper(mGMO, mAttributes.data(AttributeHelper::Upper, Qt::Horizontal)) ||
+            gmoGetVarScale(mGMO, mAttributes.data(AttributeHelper::Scale, Qt::Horizontal))) {
+        mLogMessages << "loadAttributes() -> Something went wrong!";
+    }
+    auto lower = mAttributes.data(AttributeHelper::Lower, Qt::Vertical);
+    auto upper = mAttributes.data(AttributeHelper::Upper, Qt::Vertical);
+    for (int row=0; row<equationRowCount(); ++row) {
+        auto bounds = equationBounds(row);
+        lower[row] = bounds.first;
+        upper[row] = bounds.second;
     }
 }
 
@@ -274,7 +304,8 @@ void ModelInstance::loadSymbols()
             sym->setFirstSection(sectionIndexEqn);
             sym->setLogicalIndex(eqnIndex++);
             sectionIndexEqn += sym->entries();
-            loadEquationDimensions(sym); // TODO !!! PERF optimize or load/lazy load
+            sym->setLabelTable(&mLabels);
+            sym->setLabelLoader([this, sym]{ loadSymbolLabels(sym); });
             sym->setLabelTree(QSharedPointer<LabelTreeItem>(new LabelTreeItem));
             mEquations.append(sym);
             for (int i=sym->firstSection(); i<=sym->lastSection(); ++i) {
@@ -288,7 +319,8 @@ void ModelInstance::loadSymbols()
             sym->setFirstSection(sectionIndexVar);
             sym->setLogicalIndex(varIndex++);
             sectionIndexVar += sym->entries();
-            loadVariableDimensions(sym); // TODO !!! PERF optimize or load/lazy load
+            sym->setLabelTable(&mLabels);
+            sym->setLabelLoader([this, sym]{ loadSymbolLabels(sym); });
             sym->setLabelTree(QSharedPointer<LabelTreeItem>(new LabelTreeItem));
             mVariables.append(sym);
             for (int i=sym->firstSection(); i<=sym->lastSection(); ++i) {
@@ -346,58 +378,89 @@ Symbol* ModelInstance::loadSymbol(int index)
     return sym;
 }
 
-void ModelInstance::loadEquationDimensions(Symbol *symbol)
+void ModelInstance::loadEquationDimensions(dctHandle_t dct, Symbol *symbol)
 {
-    char quote;
     int nDomains = 0;
-    char labelName[GMS_SSSIZE];
     int domains[GLOBAL_MAX_INDEX_DIM];
     for (int j=0; j<symbol->entries(); ++j) {
-        if (gmoGetiSolverQuiet(mGMO, symbol->offset() + j) < 0) {
-            mLogMessages << "ERROR: calling gmoGetiSolverQuiet() in ModelInstance::loadDimensions()";
-            continue;
-        }
-
         int symIndex;
-        if (dctRowUels(mDCT, symbol->offset()+j, &symIndex, domains, &nDomains)) {
-            mLogMessages << "ERROR: calling dctRowUels() in ModelInstance::loadDimensions()";
+        if (dctRowUels(dct, symbol->offset()+j, &symIndex, domains, &nDomains)) {
+            mLabelErrors << "ERROR: calling dctRowUels() in ModelInstance::loadDimensions()";
             continue;
         }
 
-        QStringList labels;
-        for (int k=0; k<nDomains; ++k) {
-            dctUelLabel(mDCT, domains[k], &quote, labelName, GMS_SSSIZE);
-            labels << labelName;
-        }
-        symbol->setLabels(symbol->firstSection()+j, labels);
+        symbol->setLabelIndices(symbol->firstSection()+j, domains, nDomains);
     }
 }
 
-void ModelInstance::loadVariableDimensions(Symbol *symbol)
+void ModelInstance::loadVariableDimensions(dctHandle_t dct, Symbol *symbol)
 {
-    char quote;
     int nDomains = 0;
-    char labelName[GMS_SSSIZE];
     int domains[GLOBAL_MAX_INDEX_DIM];
     for (int j=0; j<symbol->entries(); ++j) {
-        if (gmoGetjSolverQuiet(mGMO, symbol->offset() + j) < 0) {
-            mLogMessages << "ERROR: calling gmoGetjSolverQuiet() in ModelInstance::loadDimensions()";
-            continue;
-        }
-
         int symIndex;
-        if (dctColUels(mDCT, symbol->offset()+j, &symIndex, domains, &nDomains)) {
-            mLogMessages << "ERROR: calling dctColUels() in ModelInstance::loadDimensions()";
+        if (dctColUels(dct, symbol->offset()+j, &symIndex, domains, &nDomains)) {
+            mLabelErrors << "ERROR: calling dctColUels() in ModelInstance::loadDimensions()";
             continue;
         }
 
-        QStringList labels;
-        for (int k=0; k<nDomains; ++k) {
-            dctUelLabel(mDCT, domains[k], &quote, labelName, GMS_SSSIZE);
-            labels << labelName;
+        symbol->setLabelIndices(symbol->firstSection()+j, domains, nDomains);
+    }
+}
+
+void ModelInstance::loadSymbolLabels(Symbol *symbol)
+{
+    QMutexLocker locker(&mLabelMutex);
+    if (symbol->labelsLoaded())
+        return;
+    // without an own dictionary the labels are loaded on first use only
+    auto dct = mLabelDCT ? mLabelDCT : mDCT;
+    if (symbol->isEquation())
+        loadEquationDimensions(dct, symbol);
+    else
+        loadVariableDimensions(dct, symbol);
+    symbol->setLabelsLoaded(true);
+}
+
+void ModelInstance::prefetchSymbolLabels()
+{
+    if (!mLabelDCT)
+        return;
+    mLabelPrefetch = QtConcurrent::run([this]{
+        for (const auto& symbols : { mEquations, mVariables }) {
+            for (auto symbol : symbols) {
+                if (mLabelPrefetchCanceled.loadRelaxed())
+                    return;
+                loadSymbolLabels(symbol);
+            }
         }
-        symbol->setLabels(symbol->firstSection()+j, labels);
+    });
+}
+
+bool ModelInstance::createLabelDictionary()
+{
+    char msg[GMS_SSSIZE];
+    char dictFile[GMS_SSSIZE];
+    gmoNameDict(mGMO, dictFile);
+    if (!dctCreateD(&mLabelDCT, mSystemDir.toStdString().c_str(), msg, sizeof(msg))) {
+        mLogMessages << "ERROR: " + QString(msg);
+        mLabelDCT = nullptr;
+        return false;
+    }
+    if (dctLoadEx(mLabelDCT, dictFile, msg, sizeof(msg))) {
+        mLogMessages << "ERROR: Could not load label dictionary: " + QString(msg);
+        dctFree(&mLabelDCT);
+        mLabelDCT = nullptr;
+        return false;
     }
+    return true;
+}
+
+void ModelInstance::appendLabelErrors()
+{
+    QMutexLocker locker(&mLabelMutex);
+    mLogMessages << mLabelErrors;
+    mLabelErrors.clear();
 }
 
 const QVector<Symbol*>& ModelInstance::symbols(Symbol::Type type) const
@@ -407,9 +470,12 @@ const QVector<Symbol*>& ModelInstance::symbols(Symbol::Type type) const
 
 void ModelInstance::loadBaseData()
 {
+    createLabelDictionary();
     loadSymbols();
     loadLabels();
+    loadAttributes();
     mDataHandler->loadJacobian();
+    prefetchSymbolLabels();
 }
 
 void ModelInstance::variableLowerBounds(double *bounds)
@@ -431,6 +497,13 @@ double ModelInstance::rhs(int row) const
     return gmoGetRhsOne(mGMO, row);
 }
 
+void ModelInstance::equationRhs(double *values)
+{
+    if (gmoGetRhs(mGMO, values)) {
+        mLogMessages << "equationRhs() -> Something went wrong!";
+    }
+}
+
 int ModelInstance::rowCount(int viewId) const
 {
     return mDataHandler->rowCount(viewId);
@@ -468,7 +541,13 @@ QSharedPointer<AbstractViewConfiguration> ModelInstance::clone(int viewId, int n
 
 void ModelInstance::loadViewData(QSharedPointer<AbstractViewConfiguration> viewConfig)
 {
-    return mDataHandler->loadData(viewConfig);
+    mDataHandler->loadData(viewConfig);
+    appendLabelErrors();
+}
+
+bool ModelInstance::updateViewData(QSharedPointer<AbstractViewConfiguration> viewConfig)
+{
+    return mDataHandler->updateData(viewConfig);
 }
 
 void ModelInstance::loadLabels()
@@ -498,6 +577,11 @@ QVariant ModelInstance::data(int row, int column, int viewId) const
     return mDataHandler->data(row, column, viewId);
 }
 
+NumericValue ModelInstance::numericData(int row, int column, int viewId) const
+{
+    return mDataHandler->numericData(row, column, viewId);
+}
+
 int ModelInstance::nlFlag(int row, int column, int viewId)
 {
     return mDataHandler->nlFlag(row, column, viewId);
@@ -525,6 +609,13 @@ QVariant ModelInstance::headerData(int logicalIndex,
     return QVariant();
 }
 
+QList<int> ModelInstance::logicalIndices(int section,
+                                        Qt::Orientation orientation,
+                                        int viewId) const
+{
+    return mDataHandler->logicalIndices(section, orientation, viewId);
+}
+
 QVariant ModelInstance::plainHeaderData(Qt::Orientation orientation,
                                         int viewId,
                                         int logicalIndex,
@@ -596,202 +687,359 @@ void ModelInstance::initialize()
     }
 }
 
+///
+/// \brief Minimum number of nonlinear entries per worker, i.e. smaller
+///        models are loaded sequentially.
+///
+const int MinParallelNlEntries = 20000;
+
+///
+/// \brief Maximum number of Jacobian entries of all worker model copies.
+/// \remark Each worker holds a full copy of the model, i.e. large models
+///         get less workers.
+///
+const qint64 MaxWorkerModelEntries = 50000000;
+
+///
+/// \brief Row range of the Jacobian loaded by one worker.
+///
+struct JacobianBlock
+{
+    int Worker = 0;
+    int FirstRow = 0;
+    int LastRow = -1;
+    bool Loaded = false;
+    QVector<int> FailedRows;
+    QStringList Errors;
+};
+
 DataMatrix* ModelInstance::jacobianData()
 {
-    int nz = 0, nlnz = 0, unused1 = 0;
+    int nz = 0, nlnz = 0, unused1 = 0, maxEntries = 0, entriesNl = 0;
+    qint64 entries = 0;
     auto matrix = new DataMatrix(equationRowCount(), variableRowCount(), gmoNLM(mGMO));
     loadEvaluationPoint(matrix->evalPoint(), matrix->columnCount());
-    if (matrix->isLinear()) {
+    for (int row=0; row<equationRowCount(); ++row) {
+        if (gmoGetRowStat(mGMO, row, &nz, &unused1, &nlnz))
+            continue;
+        matrix->setRowEntries(row, nz, nlnz);
+        maxEntries = std::max(maxEntries, nz);
+        entriesNl += nlnz;
+        entries += nz;
+    }
+    matrix->allocate();
+
+    // the gradient evaluation dominates for nonlinear models, which is done
+    // on row blocks with roughly the same number of nonlinear entries
+    int workers = 1;
+    if (!matrix->isLinear() && entriesNl) {
+        if (mJacobianWorkers) {
+            workers = mJacobianWorkers;
+        } else {
+            workers = std::min(QThread::idealThreadCount(), entriesNl / MinParallelNlEntries);
+            workers = std::min<qint64>(workers, MaxWorkerModelEntries / std::max<qint64>(entries, 1));
+        }
+    }
+    QVector<JacobianBlock> blocks;
+    if (workers > 1) {
+        int blockEntriesNl = entriesNl / workers + 1, currentEntriesNl = 0;
+        JacobianBlock block;
         for (int row=0; row<equationRowCount(); ++row) {
-            if (gmoGetRowStat(mGMO, row, &nz, &unused1, &nlnz))
-                continue;
-            auto* dataRow = matrix->row(row);
-            dataRow->setEntries(nz);
-            dataRow->setEntriesNl(nlnz);
-            dataRow->setColIdx(new int[nz]);
-            dataRow->setInputData(new double[nz]);
-            dataRow->setNlFlags(new int[nz]);
-            if (gmoGetRowSparse(mGMO, row, dataRow->colIdx(), dataRow->inputData(),
-                                dataRow->nlFlags(), &unused1, &nlnz)) {
-                continue;
+            currentEntriesNl += matrix->row(row).entriesNl();
+            if (currentEntriesNl >= blockEntriesNl) {
+                block.LastRow = row;
+                blocks.append(block);
+                block.Worker = blocks.size();
+                block.FirstRow = row + 1;
+                currentEntriesNl = 0;
             }
         }
+        block.LastRow = equationRowCount() - 1;
+        if (block.FirstRow <= block.LastRow)
+            blocks.append(block);
+        // the handles are created once and kept for later loads, where each
+        // block owns the handles of its worker index
+        if (mWorkerHandles.size() < blocks.size())
+            mWorkerHandles.resize(blocks.size());
+        // the GAMS API libraries are loaded without locks, i.e. the handles
+        // are created here and only the row extraction runs in parallel
+        for (const auto& block : std::as_const(blocks)) {
+            auto& handles = mWorkerHandles[block.Worker];
+            if (!handles.Loaded)
+                handles.Loaded = createWorkerHandles(handles.GEV, handles.GMO);
+        }
+        auto workerHandles = mWorkerHandles.data();
+        QtConcurrent::blockingMap(blocks, [this, matrix, maxEntries, workerHandles](JacobianBlock &block) {
+            auto& handles = workerHandles[block.Worker];
+            if (!handles.Loaded)
+                return;
+            int* nlFlags = new int[maxEntries];
+            double* scratch = new double[matrix->columnCount()];
+            loadJacobianRows(handles.GMO, matrix, block.FirstRow, block.LastRow,
+                             nlFlags, scratch, block.FailedRows, block.Errors);
+            block.Loaded = true;
+            delete[] nlFlags;
+            delete[] scratch;
+        });
     } else {
-        double* scratch = new double[matrix->columnCount()];
-        for (int row=0; row<equationRowCount(); ++row) {
-            if (gmoGetRowStat(mGMO, row, &nz, &unused1, &nlnz))
-                continue;
-            auto* dataRow = matrix->row(row);
-            dataRow->setEntries(nz);
-            dataRow->setEntriesNl(nlnz);
-            dataRow->setColIdx(new int[nz]);
-            dataRow->setInputData(new double[nz]);
-            dataRow->setOutputData(new double[nz]);
-            dataRow->setNlFlags(new int[nz]);
-            if (gmoGetRowSparse(mGMO, row, dataRow->colIdx(), dataRow->inputData(),
-                                dataRow->nlFlags(), &unused1, &nlnz)) {
-                continue;
-            }
-            std::copy(dataRow->inputData(), dataRow->inputData()+dataRow->entries(), dataRow->outputData());
-            if (!dataRow->entriesNl()) {
-                continue;
-            }
-            int numerr = 0;
-            double fnl = 0, gxnl = 0; // not needed
-            if (gmoEvalGradNL(mGMO, row, matrix->evalPoint(), &fnl, scratch, &gxnl, &numerr)) {
-                mLogMessages << QString("Gradient evaluation in Line %1 failed. Please check your model").arg(row);
-                mState = Error;
-                continue;
-            }
-            for (int c=0; c<dataRow->entries(); ++c) {
-                if (dataRow->nlFlags()[c]) {
-                    dataRow->outputData()[c] = scratch[dataRow->colIdx()[c]];
-                }
-            }
+        JacobianBlock block;
+        block.LastRow = equationRowCount() - 1;
+        blocks.append(block);
+    }
+
+    // blocks without worker handles are loaded by the model instance itself
+    QVector<int> failedRows;
+    int* nlFlags = new int[maxEntries];
+    double* scratch = matrix->isLinear() ? nullptr : new double[matrix->columnCount()];
+    for (auto& block : blocks) {
+        if (!block.Loaded) {
+            loadJacobianRows(mGMO, matrix, block.FirstRow, block.LastRow,
+                             nlFlags, scratch, block.FailedRows, block.Errors);
+        }
+        failedRows << block.FailedRows;
+        if (!block.Errors.isEmpty()) {
+            mLogMessages << block.Errors;
+            mState = Error;
         }
-        delete[] scratch;
     }
+    delete[] nlFlags;
+    delete[] scratch;
+    matrix->clearRows(failedRows);
     return matrix;
 }
 
-QVariant ModelInstance::equationAttribute(const QString &header, int index, int entry, bool abs) const
+void ModelInstance::loadJacobianRows(gmoHandle_t gmo, DataMatrix *matrix,
+                                     int firstRow, int lastRow,
+                                     int *nlFlags, double *scratch,
+                                     QVector<int> &failedRows,
+                                     QStringList &errors) const
+{
+    int nlnz = 0, unused1 = 0;
+    for (int row=firstRow; row<=lastRow; ++row) {
+        auto dataRow = matrix->row(row);
+        if (!dataRow.entries())
+            continue;
+        // GMO reports one int per NL flag, which are packed into the matrix bits
+        if (gmoGetRowSparse(gmo, row, dataRow.colIdx(), dataRow.inputData(),
+                            nlFlags, &unused1, &nlnz)) {
+            errors << QString("Loading the entries of Line %1 failed. Please check your model").arg(row);
+            failedRows << row;
+            continue;
+        }
+        NlFlags::pack(nlFlags, dataRow.entries(), dataRow.nlFlags());
+        if (matrix->isLinear())
+            continue;
+        std::copy(dataRow.inputData(), dataRow.inputData()+dataRow.entries(), dataRow.outputData());
+        if (!dataRow.entriesNl()) {
+            continue;
+        }
+        int numerr = 0;
+        double fnl = 0, gxnl = 0; // not needed
+        if (gmoEvalGradNL(gmo, row, matrix->evalPoint(), &fnl, scratch, &gxnl, &numerr)) {
+            errors << QString("Gradient evaluation in Line %1 failed. Please check your model").arg(row);
+            continue;
+        }
+        for (int c=0; c<dataRow.entries(); ++c) {
+            if (nlFlags[c]) {
+                dataRow.outputData()[c] = scratch[dataRow.colIdx()[c]];
+            }
+        }
+    }
+}
+
+bool ModelInstance::createWorkerHandles(gevHandle_t &gev, gmoHandle_t &gmo) const
+{
+    char msg[GMS_SSSIZE];
+    if (!gev && !gevCreateD(&gev, mSystemDir.toStdString().c_str(), msg, sizeof(msg))) {
+        gev = nullptr;
+        return false;
+    }
+    if (!gmo && !gmoCreateD(&gmo, mSystemDir.toStdString().c_str(), msg, sizeof(msg))) {
+        gmo = nullptr;
+        return false;
+    }
+    // blocks of workers without handles are loaded sequentially, i.e. the
+    // messages are not logged
+    QStringList messages;
+    return loadModel(gev, gmo, messages);
+}
+
+QVariant ModelInstance::equationAttribute(AttributeHelper::AttributeType type, int index, int entry, bool abs) const
 {
     double value = 0.0;
     int absoluteIndex = index + entry;
-    if (!header.compare(AttributeHelper::LevelText, Qt::CaseInsensitive)) {
-        value = gmoGetEquLOne(mGMO, absoluteIndex);
-    } else if (!header.compare(AttributeHelper::LowerText, Qt::CaseInsensitive)) {
-        auto bounds = equationBounds(absoluteIndex);
-        value = bounds.first;
-    } else if (!header.compare(AttributeHelper::MarginalText, Qt::CaseInsensitive)) {
-        value = gmoGetEquMOne(mGMO, absoluteIndex);
+    double level = mAttributes.value(AttributeHelper::Level, Qt::Vertical, absoluteIndex);
+    double lower = mAttributes.value(AttributeHelper::Lower, Qt::Vertical, absoluteIndex);
+    double upper = mAttributes.value(AttributeHelper::Upper, Qt::Vertical, absoluteIndex);
+    switch (type) {
+    case AttributeHelper::Level:
+        value = level;
+        break;
+    case AttributeHelper::Lower:
+        value = lower;
+        break;
+    case AttributeHelper::Marginal:
+        value = mAttributes.value(AttributeHelper::Marginal, Qt::Vertical, absoluteIndex);
         return specialMarginalEquValuePtr(value, absoluteIndex, abs);
-    } else if (!header.compare(AttributeHelper::MarginalNumText, Qt::CaseInsensitive)) {
-        return specialValue(gmoGetEquMOne(mGMO, absoluteIndex));
-    } else if (!header.compare(AttributeHelper::ScaleText, Qt::CaseInsensitive)) {
-        value = gmoGetEquScaleOne(mGMO, absoluteIndex);
-    } else if (!header.compare(AttributeHelper::UpperText, Qt::CaseInsensitive)) {
-        auto bounds = equationBounds(absoluteIndex);
-        value = bounds.second;
-    } else if (!header.compare(AttributeHelper::InfeasibilityText, Qt::CaseInsensitive)) {
-        double a = specialValue(equationBounds(absoluteIndex).first);
-        double b = specialValue(gmoGetEquLOne(mGMO, absoluteIndex));
+    case AttributeHelper::MarginalNum:
+        return specialValue(mAttributes.value(AttributeHelper::Marginal, Qt::Vertical, absoluteIndex));
+    case AttributeHelper::Scale:
+        value = mAttributes.value(AttributeHelper::Scale, Qt::Vertical, absoluteIndex);
+        break;
+    case AttributeHelper::Upper:
+        value = upper;
+        break;
+    case AttributeHelper::Infeasibility:
+    {
+        double a = specialValue(lower);
+        double b = specialValue(level);
         double v1 = AttributeHelper::attributeValue(a, b, isInf(a), isInf(b));
-        a = specialValue(gmoGetEquLOne(mGMO, absoluteIndex));
-        b = specialValue(equationBounds(absoluteIndex).second);
+        a = specialValue(level);
+        b = specialValue(upper);
         double v2 = AttributeHelper::attributeValue(a, b, isInf(a), isInf(b));
         value = std::max(0.0, std::max(v1, v2));
         value = abs ? std::abs(value) : value;
         return isInf(value) ? specialValuePostopt(value, abs) : value;
-    } else if (!header.compare(AttributeHelper::RangeText, Qt::CaseInsensitive)) {
-        double a = specialValue(equationBounds(absoluteIndex).second);
-        double b = specialValue(equationBounds(absoluteIndex).first);
+    }
+    case AttributeHelper::Range:
+    {
+        double a = specialValue(upper);
+        double b = specialValue(lower);
         value = AttributeHelper::attributeValue(a, b, isInf(a), isInf(b));
-    } else if (!header.compare(AttributeHelper::SlackText, Qt::CaseInsensitive)) {
-        double a = specialValue(gmoGetEquLOne(mGMO, absoluteIndex));
-        double b = specialValue(equationBounds(absoluteIndex).first);
+        break;
+    }
+    case AttributeHelper::Slack:
+    {
+        double a = specialValue(level);
+        double b = specialValue(lower);
         double v1 = AttributeHelper::attributeValue(a, b, isInf(a), isInf(b));
         v1 = std::max(0.0, v1);
         v1 = abs ? std::abs(v1) : v1;
-        a = specialValue(equationBounds(absoluteIndex).second);
-        b = specialValue(gmoGetEquLOne(mGMO, absoluteIndex));
+        a = specialValue(upper);
+        b = specialValue(level);
         double v2 = AttributeHelper::attributeValue(a, b, isInf(a), isInf(b));
         v2 = std::max(0.0, v2);
         v2 = abs ? std::abs(v2) : v2;
         value = std::min(v1, v2);
         return isInf(value) ? specialValuePostopt(value, abs) : value;
-    } else if (!header.compare(AttributeHelper::SlackLBText, Qt::CaseInsensitive)) {
-        double a = specialValue(gmoGetEquLOne(mGMO, absoluteIndex));
-        double b = specialValue(equationBounds(absoluteIndex).first);
+    }
+    case AttributeHelper::SlackLB:
+    {
+        double a = specialValue(level);
+        double b = specialValue(lower);
         value = AttributeHelper::attributeValue(a, b, isInf(a), isInf(b));
         value = std::max(0.0, value);
         value = abs ? std::abs(value) : value;
         return isInf(value) ? specialValuePostopt(value, abs) : value;
-    } else if (!header.compare(AttributeHelper::SlackUBText, Qt::CaseInsensitive)) {
-        double a = specialValue(equationBounds(absoluteIndex).second);
-        double b = specialValue(gmoGetEquLOne(mGMO, absoluteIndex));
+    }
+    case AttributeHelper::SlackUB:
+    {
+        double a = specialValue(upper);
+        double b = specialValue(level);
         value = AttributeHelper::attributeValue(a, b, isInf(a), isInf(b));
         value = std::max(0.0, value);
         value = abs ? std::abs(value) : value;
         return isInf(value) ? specialValuePostopt(value, abs) : value;
-    } else if (!header.compare(AttributeHelper::TypeText, Qt::CaseInsensitive)) {
+    }
+    case AttributeHelper::Type:
         return QChar(equationType(index));
-    } else {
+    default:
         return "## Undefined ##";
     }
     value = abs ? std::abs(value) : value;
     return specialValuePostopt(value, abs);
 }
 
-QVariant ModelInstance::variableAttribute(const QString &header, int index, int entry, bool abs) const
+QVariant ModelInstance::variableAttribute(AttributeHelper::AttributeType type, int index, int entry, bool abs) const
 {
     double value = 0.0;
     int absoluteIndex = index + entry;
-    if (!header.compare(AttributeHelper::LevelText, Qt::CaseInsensitive)) {
-        value = gmoGetVarLOne(mGMO, absoluteIndex);
-    } else if (!header.compare(AttributeHelper::LowerText, Qt::CaseInsensitive)) {
-        value = gmoGetVarLowerOne(mGMO, absoluteIndex);
-    } else if (!header.compare(AttributeHelper::MarginalText, Qt::CaseInsensitive)) {
-        value = gmoGetVarMOne(mGMO, absoluteIndex);
+    double level = mAttributes.value(AttributeHelper::Level, Qt::Horizontal, absoluteIndex);
+    double lower = mAttributes.value(AttributeHelper::Lower, Qt::Horizontal, absoluteIndex);
+    double upper = mAttributes.value(AttributeHelper::Upper, Qt::Horizontal, absoluteIndex);
+    switch (type) {
+    case AttributeHelper::Level:
+        value = level;
+        break;
+    case AttributeHelper::Lower:
+        value = lower;
+        break;
+    case AttributeHelper::Marginal:
+        value = mAttributes.value(AttributeHelper::Marginal, Qt::Horizontal, absoluteIndex);
         return specialMarginalVarValuePtr(value, absoluteIndex, abs);
-    } else if (!header.compare(AttributeHelper::ScaleText, Qt::CaseInsensitive)) {
-        value = gmoGetVarScaleOne(mGMO, absoluteIndex);
-    } else if (!header.compare(AttributeHelper::UpperText, Qt::CaseInsensitive)) {
-        value = gmoGetVarUpperOne(mGMO, absoluteIndex);
-    } else if (!header.compare(AttributeHelper::InfeasibilityText, Qt::CaseInsensitive)) {
-        double a = specialValue(gmoGetVarLowerOne(mGMO, absoluteIndex));
-        double b = specialValue(gmoGetVarLOne(mGMO, absoluteIndex));
+    case AttributeHelper::Scale:
+        value = mAttributes.value(AttributeHelper::Scale, Qt::Horizontal, absoluteIndex);
+        break;
+    case AttributeHelper::Upper:
+        value = upper;
+        break;
+    case AttributeHelper::Infeasibility:
+    {
+        double a = specialValue(lower);
+        double b = specialValue(level);
         double v1 = AttributeHelper::attributeValue(a, b, isInf(a), isInf(b));
-        a = specialValue(gmoGetVarLOne(mGMO, absoluteIndex));
-        b = specialValue(gmoGetVarUpperOne(mGMO, absoluteIndex));
+        a = specialValue(level);
+        b = specialValue(upper);
         double v2 = AttributeHelper::attributeValue(a, b, isInf(a), isInf(b));
         value = std::max(0.0, std::max(v1, v2));
         value = abs ? std::abs(value) : value;
         return isInf(value) ? specialValuePostopt(value, abs) : value;
-    } else if (!header.compare(AttributeHelper::RangeText, Qt::CaseInsensitive)) {
-        double a = specialValue(gmoGetVarUpperOne(mGMO, absoluteIndex));
-        double b = specialValue(gmoGetVarLowerOne(mGMO, absoluteIndex));
+    }
+    case AttributeHelper::Range:
+    {
+        double a = specialValue(upper);
+        double b = specialValue(lower);
         value = AttributeHelper::attributeValue(a, b, isInf(a), isInf(b));
-    } else if (!header.compare(AttributeHelper::SlackText, Qt::CaseInsensitive)) {
-        double a = specialValue(gmoGetVarLOne(mGMO, absoluteIndex));
-        double b = specialValue(gmoGetVarLowerOne(mGMO, absoluteIndex));
+        break;
+    }
+    case AttributeHelper::Slack:
+    {
+        double a = specialValue(level);
+        double b = specialValue(lower);
         double v1 = AttributeHelper::attributeValue(a, b, isInf(a), isInf(b));
         v1 = std::max(0.0, v1);
         v1 = abs ? std::abs(v1) : v1;
-        a = specialValue(gmoGetVarUpperOne(mGMO, absoluteIndex));
-        b = specialValue(gmoGetVarLOne(mGMO, absoluteIndex));
+        a = specialValue(upper);
+        b = specialValue(level);
         double v2 = AttributeHelper::attributeValue(a, b, isInf(a), isInf(b));
         v2 = std::max(0.0, v2);
         v2 = abs ? std::abs(v2) : v2;
         value = std::min(v1, v2);
         return isInf(value) ? specialValuePostopt(value, abs) : value;
-    } else if (!header.compare(AttributeHelper::SlackLBText, Qt::CaseInsensitive)) {
-        double a = specialValue(gmoGetVarLOne(mGMO, absoluteIndex));
-        double b = specialValue(gmoGetVarLowerOne(mGMO, absoluteIndex));
+    }
+    case AttributeHelper::SlackLB:
+    {
+        double a = specialValue(level);
+        double b = specialValue(lower);
         value = AttributeHelper::attributeValue(a, b, isInf(a), isInf(b));
         value = std::max(0.0, value);
         value = abs ? std::abs(value) : value;
         return isInf(value) ? specialValuePostopt(value, abs) : value;
-    } else if (!header.compare(AttributeHelper::SlackUBText, Qt::CaseInsensitive)) {
-        double a = specialValue(gmoGetVarUpperOne(mGMO, absoluteIndex));
-        double b = specialValue(gmoGetVarLOne(mGMO, absoluteIndex));
+    }
+    case AttributeHelper::SlackUB:
+    {
+        double a = specialValue(upper);
+        double b = specialValue(level);
         value = AttributeHelper::attributeValue(a, b, isInf(a), isInf(b));
         value = std::max(0.0, value);
         value = abs ? std::abs(value) : value;
         return isInf(value) ? specialValuePostopt(value, abs) : value;
-    } else if (!header.compare(AttributeHelper::TypeText, Qt::CaseInsensitive)) {
-        auto type = QChar(variableType(index));
-        if (type == 'x') { // x = continuous
-            if (gmoGetVarLowerOne(mGMO, absoluteIndex) >= 0 && gmoGetVarUpperOne(mGMO, absoluteIndex) >= 0) {
+    }
+    case AttributeHelper::Type:
+    {
+        auto varType = QChar(variableType(index));
+        if (varType == 'x') { // x = continuous
+            if (lower >= 0 && upper >= 0) {
                 return QChar('+');
-            } else if (gmoGetVarLowerOne(mGMO, absoluteIndex) <= 0 && gmoGetVarUpperOne(mGMO, absoluteIndex) <= 0) {
+            } else if (lower <= 0 && upper <= 0) {
                 return QChar('-');
             } else {
                 return QChar('u');
             }
         }
-        return QChar(variableType(index));
-    } else {
+        return varType;
+    }
+    default:
         return "## Undefined ##";
     }
     value = abs ? std::abs(value) : value;
@@ -22,11 +22,14 @@
 #define MODELINSTANCE_H
 
 #include "abstractmodelinstance.h"
+#include "attributecache.h"
 
 #include "gevmcc.h"
 #include "gmomcc.h"
 #include "dctmcc.h"
 
+#include <QFuture>
+#include <QMutex>
 #include <QVariant>
 
 namespace gams {
@@ -78,6 +81,8 @@ public:
 
     double rhs(int row) const override;
 
+    void equationRhs(double *values) override;
+
     QString longestEquationText() const override;
 
     QString longestVariableText() const override;
@@ -96,6 +101,8 @@ public:
 
     void loadViewData(QSharedPointer<AbstractViewConfiguration> viewConfig) override;
 
+    bool updateViewData(QSharedPointer<AbstractViewConfiguration> viewConfig) override;
+
     int rowCount(int viewId) const override;
 
     int rowEntries(int row, int viewId) const override;
@@ -112,6 +119,8 @@ public:
 
     QVariant data(int row, int column, int viewId) const override;
 
+    NumericValue numericData(int row, int column, int viewId) const override;
+
     int nlFlag(int row, int column, int viewId) override;
 
     QSharedPointer<PostoptTreeItem> dataTree(int viewId) const override;
@@ -121,6 +130,10 @@ public:
                         int viewId,
                         int role) const override;
 
+    QList<int> logicalIndices(int section,
+                              Qt::Orientation orientation,
+                              int viewId) const override;
+
     QVariant plainHeaderData(Qt::Orientation orientation,
                              int viewId,
                              int logicalIndex,
@@ -128,10 +141,21 @@ public:
     
     DataMatrix* jacobianData() override;
 
-    QVariant equationAttribute(const QString &header,
+    ///
+    /// \brief Sets the number of workers of the Jacobian extraction, where
+    ///        0 (default) chooses the number by the model size and 1 loads
+    ///        the Jacobian sequentially.
+    ///
+    void setJacobianWorkers(int workers);
+
+    using AbstractModelInstance::equationAttribute;
+
+    QVariant equationAttribute(AttributeHelper::AttributeType type,
                                int index, int entry, bool abs) const override;
 
-    QVariant variableAttribute(const QString &header,
+    using AbstractModelInstance::variableAttribute;
+
+    QVariant variableAttribute(AttributeHelper::AttributeType type,
                                int index, int entry, bool abs) const override;
 
     int maxSymbolDimension(int viewId, Qt::Orientation orientation) const override;
@@ -149,10 +173,79 @@ private:
 
     void loadEvaluationPoint(double *evalPoint, int size);
 
+    ///
+    /// \brief Loads the attribute vectors of all rows and columns.
+    ///
+    void loadAttributes();
+
+    ///
+    /// \brief Fills the Jacobian rows <c>firstRow</c> to <c>lastRow</c>.
+    /// \param gmo GMO handle used for the row extraction.
+    /// \param matrix Allocated matrix to fill.
+    /// \param nlFlags Buffer for the GMO NL flags of at least one row.
+    /// \param scratch Gradient buffer of <c>columnCount()</c> size, only
+    ///        needed for nonlinear models.
+    /// \param failedRows Rows whose entries couldn't be loaded, which have to
+    ///        be removed by DataMatrix::clearRows().
+    /// \param errors Error messages, i.e. rows where the gradient evaluation
+    ///        failed.
+    /// \remark Doesn't touch any member, which allows to call it from worker
+    ///         threads that use their own GMO handle.
+    ///
+    void loadJacobianRows(gmoHandle_t gmo, DataMatrix *matrix,
+                          int firstRow, int lastRow,
+                          int *nlFlags, double *scratch,
+                          QVector<int> &failedRows,
+                          QStringList &errors) const;
+
+    ///
+    /// \brief Initializes the environment of <c>gev</c> and loads the model
+    ///        into <c>gmo</c>, including the solution if the output is used.
+    /// \remark Used for the model instance handles and the worker handles,
+    ///         so that all handles evaluate at the same point.
+    ///
+    bool loadModel(gevHandle_t gev, gmoHandle_t gmo, QStringList &messages) const;
+
+    ///
+    /// \brief Creates an additional GEV and GMO handle pair for the model,
+    ///        where existing handles are reused.
+    /// \remark Used by the parallel Jacobian extraction, where each worker
+    ///         gets its own handles.
+    ///
+    bool createWorkerHandles(gevHandle_t &gev, gmoHandle_t &gmo) const;
+
     void loadSymbols();
     Symbol* loadSymbol(int index);
-    void loadEquationDimensions(Symbol *symbol);
-    void loadVariableDimensions(Symbol *symbol);
+    void loadEquationDimensions(dctHandle_t dct, Symbol *symbol);
+    void loadVariableDimensions(dctHandle_t dct, Symbol *symbol);
+
+    ///
+    /// \brief Loads the label indices of <c>symbol</c> if not done yet.
+    /// \remark Thread-safe, i.e. used by the symbols on first access and by
+    ///         the background prefetcher. Only the label dictionary is used,
+    ///         which is guarded by <c>mLabelMutex</c>.
+    ///
+    void loadSymbolLabels(Symbol *symbol);
+
+    ///
+    /// \brief Loads the labels of all symbols in the background, which is
+    ///        only done if the label dictionary is available.
+    ///
+    void prefetchSymbolLabels();
+
+    ///
+    /// \brief Loads a second dictionary handle used by the label loading.
+    /// \remark GMO and DCT handles are not thread-safe. The label loading
+    ///         gets its own dictionary, so that it never touches the handles
+    ///         used by the views.
+    ///
+    bool createLabelDictionary();
+
+    ///
+    /// \brief Moves the errors of the label loading to the log messages.
+    ///
+    void appendLabelErrors();
+
     void loadLabels();
 
     QPair<double, double> equationBounds(int row) const;
@@ -174,6 +267,7 @@ private:
     dctHandle_t mDCT = nullptr;
     std::function<QVariant(double, int, bool)> specialMarginalEquValuePtr;
     std::function<QVariant(double, int, bool)> specialMarginalVarValuePtr;
+    AttributeCache mAttributes;
 
     int mMaxEquationDimension = 0;
     int mMaxVariableDimension = 0;
@@ -187,6 +281,25 @@ private:
     QString mLongestLabel;
     QString mLongestEqnText;
     QString mLongestVarText;
+
+    ///
+    /// \brief GEV and GMO handles of one Jacobian worker.
+    ///
+    struct WorkerHandles
+    {
+        gevHandle_t GEV = nullptr;
+        gmoHandle_t GMO = nullptr;
+        bool Loaded = false;
+    };
+
+    int mJacobianWorkers = 0;
+    QVector<WorkerHandles> mWorkerHandles;
+
+    QMutex mLabelMutex;
+    dctHandle_t mLabelDCT = nullptr;
+    QStringList mLabelErrors;
+    QFuture<void> mLabelPrefetch;
+    QAtomicInt mLabelPrefetchCanceled;
 };
 
 }
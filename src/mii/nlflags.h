@@ -0,0 +1,222 @@
+/**
+ * GAMS Model Instance Inspector (MII)
+ *
+ * Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef NLFLAGS_H
+#define NLFLAGS_H
+
+#include "densematrix.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace gams {
+namespace studio {
+namespace mii {
+
+///
+/// \brief Helpers to work on bit-packed nonlinear flags, i.e. one bit per
+///        flag stored in 64 bit words.
+///
+class NlFlags
+{
+public:
+    typedef std::uint64_t Word;
+
+    static constexpr int WordBits = 64;
+
+    ///
+    /// \brief Number of words needed to store <c>flags</c> bits.
+    ///
+    static constexpr int words(int flags)
+    {
+        return flags > 0 ? (flags + WordBits - 1) / WordBits : 0;
+    }
+
+    static inline bool test(const Word *words, int index)
+    {
+        return (words[index / WordBits] >> (index % WordBits)) & Word(1);
+    }
+
+    static inline void set(Word *words, int index, bool flag = true)
+    {
+        auto mask = Word(1) << (index % WordBits);
+        if (flag)
+            words[index / WordBits] |= mask;
+        else
+            words[index / WordBits] &= ~mask;
+    }
+
+    ///
+    /// \brief Packs <c>count</c> int flags (as returned by GMO) into <c>words</c>.
+    /// \remark <c>words</c> must hold at least <c>words(count)</c> words.
+    ///
+    static void pack(const int *flags, int count, Word *words)
+    {
+        std::fill(words, words+NlFlags::words(count), Word(0));
+        for (int i=0; i<count; ++i) {
+            if (flags[i])
+                words[i / WordBits] |= Word(1) << (i % WordBits);
+        }
+    }
+};
+
+///
+/// \brief Dense bit matrix of nonlinear flags, e.g. used for the cells of the
+///        block pattern views.
+/// \remark Each row starts at a word boundary, which allows to combine whole
+///         rows word by word. The words are a DenseMatrix, i.e. copies share
+///         them until one of them is changed (copy-on-write).
+///
+class NlFlagMatrix
+{
+public:
+    ///
+    /// \brief Writable flags of a detached matrix.
+    /// \remark The flags are valid until the matrix is copied, assigned or
+    ///         destroyed.
+    ///
+    class Flags
+    {
+    public:
+        inline void set(int row, int column, bool flag = true) const
+        {
+            NlFlags::set(mWords[row], column, flag);
+        }
+
+        ///
+        /// \brief Sets the flag of the given cell if <c>flag</c> is <c>true</c>,
+        ///        i.e. the cell becomes the logical OR of both.
+        ///
+        inline void unite(int row, int column, bool flag) const
+        {
+            if (flag)
+                set(row, column);
+        }
+
+        ///
+        /// \brief Combines <c>row</c> with <c>otherRow</c> of <c>other</c>
+        ///        (logical OR), where only the columns both matrices share are
+        ///        considered.
+        ///
+        void uniteRow(int row, const NlFlagMatrix &other, int otherRow) const
+        {
+            int columns = std::min(mColumnCount, other.mColumnCount);
+            if (columns <= 0)
+                return;
+            auto target = mWords[row];
+            auto source = other.mWords[otherRow];
+            int fullWords = columns / NlFlags::WordBits;
+            for (int w=0; w<fullWords; ++w) {
+                target[w] |= source[w];
+            }
+            if (int rest = columns % NlFlags::WordBits) {
+                target[fullWords] |= source[fullWords] & ((NlFlags::Word(1) << rest) - 1);
+            }
+        }
+
+    private:
+        friend class NlFlagMatrix;
+
+        Flags(DenseMatrix<NlFlags::Word>::Cells words, int columnCount)
+            : mWords(words)
+            , mColumnCount(columnCount)
+        {
+
+        }
+
+    private:
+        DenseMatrix<NlFlags::Word>::Cells mWords;
+        int mColumnCount;
+    };
+
+    NlFlagMatrix()
+    {
+
+    }
+
+    NlFlagMatrix(int rowCount, int columnCount)
+        : mColumnCount(columnCount)
+        , mWords(rowCount, NlFlags::words(columnCount), NlFlags::Word(0))
+    {
+
+    }
+
+    NlFlagMatrix(const NlFlagMatrix &other) = default;
+
+    NlFlagMatrix(NlFlagMatrix &&other) noexcept
+        : mColumnCount(other.mColumnCount)
+        , mWords(std::move(other.mWords))
+    {
+        other.mColumnCount = 0;
+    }
+
+    int rowCount() const
+    {
+        return mWords.rowCount();
+    }
+
+    int columnCount() const
+    {
+        return mColumnCount;
+    }
+
+    ///
+    /// \brief Checks if the words are shared with another matrix.
+    ///
+    bool isShared() const
+    {
+        return mWords.isShared();
+    }
+
+    inline bool test(int row, int column) const
+    {
+        return NlFlags::test(mWords[row], column);
+    }
+
+    ///
+    /// \brief Detaches the matrix and returns its writable flags.
+    ///
+    Flags flags()
+    {
+        return Flags(mWords.cells(), mColumnCount);
+    }
+
+    NlFlagMatrix& operator=(const NlFlagMatrix &other) = default;
+
+    NlFlagMatrix& operator=(NlFlagMatrix &&other) noexcept
+    {
+        if (this == &other)
+            return *this;
+        mColumnCount = other.mColumnCount;
+        mWords = std::move(other.mWords);
+        other.mColumnCount = 0;
+        return *this;
+    }
+
+private:
+    int mColumnCount = 0;
+    DenseMatrix<NlFlags::Word> mWords;
+};
+
+}
+}
+}
+
+#endif // NLFLAGS_H
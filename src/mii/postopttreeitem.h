@@ -24,10 +24,19 @@
 #include <QVector>
 #include <QVariant>
 
+#include <functional>
+
 namespace gams {
 namespace studio {
 namespace mii {
 
+///
+/// \brief Item of the postopt tree.
+/// \remark The children can be created on demand by a loader, which is
+///         executed once by fetchChildren(), e.g. if the item is expanded.
+///         A loader can set a new loader on the item, which creates the
+///         next batch of children on the next fetch.
+///
 class PostoptTreeItem
 {
 public:
@@ -38,6 +47,12 @@ public:
         ClickItem
     };
 
+    ///
+    /// \brief Creates the children of the given item, which are not
+    ///        appended yet.
+    ///
+    typedef std::function<QVector<PostoptTreeItem*>(PostoptTreeItem*)> Loader;
+
     explicit PostoptTreeItem(PostoptTreeItem* parent = nullptr)
         : mParent(parent)
     {
@@ -53,8 +68,11 @@ public:
 
     void append(PostoptTreeItem *child)
     {
-        if (child)
-            mChilds.append(child);
+        if (!child)
+            return;
+        child->mParent = this;
+        child->mRow = mChilds.size();
+        mChilds.append(child);
     }
 
     PostoptTreeItem* child(int index) const
@@ -73,9 +91,35 @@ public:
 
     int row() const
     {
-        if (mParent)
-            return mParent->mChilds.indexOf(const_cast<PostoptTreeItem*>(this));
-        return 0;
+        return mParent ? mRow : 0;
+    }
+
+    bool hasChildren() const
+    {
+        return !mChilds.isEmpty() || canFetchMore();
+    }
+
+    bool canFetchMore() const
+    {
+        return bool(mLoader);
+    }
+
+    void setLoader(const Loader &loader)
+    {
+        mLoader = loader;
+    }
+
+    ///
+    /// \brief Executes and removes the loader.
+    /// \return The new children, which have to be appended by the caller.
+    ///
+    QVector<PostoptTreeItem*> fetchChildren()
+    {
+        if (!mLoader)
+            return QVector<PostoptTreeItem*>();
+        auto loader = std::move(mLoader);
+        mLoader = nullptr;
+        return loader(this);
     }
 
     PostoptTreeItem* parent() const
@@ -95,8 +139,10 @@ public:
 
 private:
     PostoptTreeItem *mParent;
+    int mRow = 0;
 
     QVector<PostoptTreeItem*> mChilds;
+    Loader mLoader;
 };
 
 class GroupPostoptTreeItem : public PostoptTreeItem
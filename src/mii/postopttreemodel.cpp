@@ -48,7 +48,21 @@ QVariant PostoptTreeModel::data(const QModelIndex &index, int role) const
         return QVariant();
     if (role == Qt::DisplayRole) {
         auto *item = static_cast<PostoptTreeItem*>(index.internalPointer());
-        return item->data(index.column());
+        auto data = item->data(index.column());
+        if (data.metaType() != QMetaType::fromType<NumericValue>())
+            return data;
+        auto value = data.value<NumericValue>();
+        if (value.isSpecial())
+            return ValueHelper::specialValueText(value.Type);
+        return value.Value;
+    }
+    if (role == ViewHelper::NumericDataRole && index.column() > 0) {
+        auto *item = static_cast<PostoptTreeItem*>(index.internalPointer());
+        auto data = item->data(index.column());
+        if (data.metaType() == QMetaType::fromType<NumericValue>())
+            return data;
+        auto value = NumericValue::fromVariant(data);
+        return value.Valid ? QVariant::fromValue(value) : QVariant();
     }
     if (role == Qt::TextAlignmentRole && index.column() > 0) {
         return Qt::AlignRight;
@@ -97,12 +111,7 @@ int PostoptTreeModel::rowCount(const QModelIndex &parent) const
 {
     if (parent.column() > 0)
         return 0;
-    PostoptTreeItem *parentItem;
-    if (!parent.isValid())
-        parentItem = mRootItem.get();
-    else
-        parentItem = static_cast<PostoptTreeItem*>(parent.internalPointer());
-    return parentItem->rowCount();
+    return item(parent)->rowCount();
 }
 
 int PostoptTreeModel::columnCount(const QModelIndex &parent) const
@@ -111,6 +120,41 @@ int PostoptTreeModel::columnCount(const QModelIndex &parent) const
     return mModelInstance->columnCount(mView);
 }
 
+bool PostoptTreeModel::hasChildren(const QModelIndex &parent) const
+{
+    if (parent.column() > 0)
+        return false;
+    return item(parent)->hasChildren();
+}
+
+bool PostoptTreeModel::canFetchMore(const QModelIndex &parent) const
+{
+    if (parent.column() > 0)
+        return false;
+    return item(parent)->canFetchMore();
+}
+
+void PostoptTreeModel::fetchMore(const QModelIndex &parent)
+{
+    if (parent.column() > 0)
+        return;
+    auto parentItem = item(parent);
+    auto children = parentItem->fetchChildren();
+    if (children.isEmpty())
+        return;
+    beginInsertRows(parent, parentItem->rowCount(), parentItem->rowCount()+children.size()-1);
+    for (auto child : children)
+        parentItem->append(child);
+    endInsertRows();
+}
+
+PostoptTreeItem* PostoptTreeModel::item(const QModelIndex &index) const
+{
+    if (!index.isValid())
+        return mRootItem.get();
+    return static_cast<PostoptTreeItem*>(index.internalPointer());
+}
+
 }
 }
 }
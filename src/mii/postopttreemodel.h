@@ -58,6 +58,19 @@ public:
 
     int columnCount(const QModelIndex &parent = QModelIndex()) const override;
 
+    bool hasChildren(const QModelIndex &parent = QModelIndex()) const override;
+
+    bool canFetchMore(const QModelIndex &parent) const override;
+
+    ///
+    /// \brief Creates the children of <c>parent</c>, which are generated on
+    ///        demand from the Jacobian.
+    ///
+    void fetchMore(const QModelIndex &parent) override;
+
+private:
+    PostoptTreeItem* item(const QModelIndex &index) const;
+
 private:
     QSharedPointer<AbstractModelInstance> mModelInstance;
     QSharedPointer<PostoptTreeItem> mRootItem;
@@ -137,7 +137,6 @@ void PostoptTreeViewFrame::updateValueFilter()
     if (!mValueFormatModel)
         return;
     mValueFormatModel->setValueFilter(mViewConfig->currentValueFilter());
-    ui->treeView->expandAll();
 }
 
 void PostoptTreeViewFrame::setupView()
@@ -151,7 +150,8 @@ void PostoptTreeViewFrame::setupView()
     auto oldSelectionModel = ui->treeView->selectionModel();
     ui->treeView->setModel(mValueFormatModel);
     delete oldSelectionModel;
-    ui->treeView->expandAll();
+    // the symbol groups create their entries on demand, see PostoptTreeModel
+    ui->treeView->expandToDepth(0);
     ui->treeView->resizeColumnToContents(0);
 }
 
@@ -0,0 +1,242 @@
+/**
+ * GAMS Model Instance Inspector (MII)
+ *
+ * Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "reduction.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define MII_REDUCTION_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define MII_TARGET_SSE2
+#define MII_TARGET_AVX
+#else
+#define MII_TARGET_SSE2 __attribute__((target("sse2")))
+#define MII_TARGET_AVX __attribute__((target("avx")))
+#endif
+#endif
+
+namespace gams {
+namespace studio {
+namespace mii {
+
+namespace {
+
+const double ExtremaStartLow = std::numeric_limits<double>::lowest();
+const double ExtremaStartHigh = std::numeric_limits<double>::max();
+
+std::atomic<Reduction::Instructions>& selectedInstructions()
+{
+    static std::atomic<Reduction::Instructions> instructions(Reduction::supportedInstructions());
+    return instructions;
+}
+
+double minimumScalar(const double *values, int count, double initial)
+{
+    for (int i=0; i<count; ++i) {
+        initial = std::min(initial, values[i]);
+    }
+    return initial;
+}
+
+double maximumScalar(const double *values, int count, double initial)
+{
+    for (int i=0; i<count; ++i) {
+        initial = std::max(initial, values[i]);
+    }
+    return initial;
+}
+
+void clearExtremaStartScalar(double *values, int count)
+{
+    for (int i=0; i<count; ++i) {
+        if (values[i] == ExtremaStartLow || values[i] == ExtremaStartHigh)
+            values[i] = 0.0;
+    }
+}
+
+#if defined(MII_REDUCTION_X86)
+
+// _mm_min_pd(a, b) and _mm_max_pd(a, b) return b if the comparison is false,
+// i.e. the operand order matches std::min(b, a) and std::max(b, a).
+
+MII_TARGET_SSE2 double minimumSSE2(const double *values, int count, double initial)
+{
+    int i = 0;
+    auto acc = _mm_set1_pd(initial);
+    for (; i+2<=count; i+=2) {
+        acc = _mm_min_pd(_mm_loadu_pd(values+i), acc);
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, acc);
+    return minimumScalar(values+i, count-i, std::min(lanes[0], lanes[1]));
+}
+
+MII_TARGET_SSE2 double maximumSSE2(const double *values, int count, double initial)
+{
+    int i = 0;
+    auto acc = _mm_set1_pd(initial);
+    for (; i+2<=count; i+=2) {
+        acc = _mm_max_pd(_mm_loadu_pd(values+i), acc);
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, acc);
+    return maximumScalar(values+i, count-i, std::max(lanes[0], lanes[1]));
+}
+
+MII_TARGET_SSE2 void clearExtremaStartSSE2(double *values, int count)
+{
+    int i = 0;
+    auto low = _mm_set1_pd(ExtremaStartLow);
+    auto high = _mm_set1_pd(ExtremaStartHigh);
+    for (; i+2<=count; i+=2) {
+        auto v = _mm_loadu_pd(values+i);
+        auto mask = _mm_or_pd(_mm_cmpeq_pd(v, low), _mm_cmpeq_pd(v, high));
+        _mm_storeu_pd(values+i, _mm_andnot_pd(mask, v));
+    }
+    clearExtremaStartScalar(values+i, count-i);
+}
+
+MII_TARGET_AVX double minimumAVX(const double *values, int count, double initial)
+{
+    int i = 0;
+    auto acc = _mm256_set1_pd(initial);
+    for (; i+4<=count; i+=4) {
+        acc = _mm256_min_pd(_mm256_loadu_pd(values+i), acc);
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, acc);
+    return minimumScalar(values+i, count-i, minimumScalar(lanes, 4, initial));
+}
+
+MII_TARGET_AVX double maximumAVX(const double *values, int count, double initial)
+{
+    int i = 0;
+    auto acc = _mm256_set1_pd(initial);
+    for (; i+4<=count; i+=4) {
+        acc = _mm256_max_pd(_mm256_loadu_pd(values+i), acc);
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, acc);
+    return maximumScalar(values+i, count-i, maximumScalar(lanes, 4, initial));
+}
+
+MII_TARGET_AVX void clearExtremaStartAVX(double *values, int count)
+{
+    int i = 0;
+    auto low = _mm256_set1_pd(ExtremaStartLow);
+    auto high = _mm256_set1_pd(ExtremaStartHigh);
+    for (; i+4<=count; i+=4) {
+        auto v = _mm256_loadu_pd(values+i);
+        auto mask = _mm256_or_pd(_mm256_cmp_pd(v, low, _CMP_EQ_OQ),
+                                 _mm256_cmp_pd(v, high, _CMP_EQ_OQ));
+        _mm256_storeu_pd(values+i, _mm256_andnot_pd(mask, v));
+    }
+    clearExtremaStartScalar(values+i, count-i);
+}
+
+#endif
+
+}
+
+Reduction::Instructions Reduction::supportedInstructions()
+{
+#if defined(MII_REDUCTION_X86)
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    bool osxsave = info[2] & (1 << 27);
+    if (osxsave && (info[2] & (1 << 28)) && (_xgetbv(0) & 0x6) == 0x6)
+        return AVX;
+    if (info[3] & (1 << 26))
+        return SSE2;
+#else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx"))
+        return AVX;
+    if (__builtin_cpu_supports("sse2"))
+        return SSE2;
+#endif
+#endif
+    return Scalar;
+}
+
+Reduction::Instructions Reduction::instructions()
+{
+    return selectedInstructions().load(std::memory_order_relaxed);
+}
+
+void Reduction::setInstructions(Instructions instructions)
+{
+    if (instructions <= supportedInstructions())
+        selectedInstructions().store(instructions, std::memory_order_relaxed);
+}
+
+double Reduction::minimum(const double *values, int count, double initial)
+{
+    switch (instructions()) {
+#if defined(MII_REDUCTION_X86)
+    case AVX:
+        return minimumAVX(values, count, initial);
+    case SSE2:
+        return minimumSSE2(values, count, initial);
+#endif
+    default:
+        return minimumScalar(values, count, initial);
+    }
+}
+
+double Reduction::maximum(const double *values, int count, double initial)
+{
+    switch (instructions()) {
+#if defined(MII_REDUCTION_X86)
+    case AVX:
+        return maximumAVX(values, count, initial);
+    case SSE2:
+        return maximumSSE2(values, count, initial);
+#endif
+    default:
+        return maximumScalar(values, count, initial);
+    }
+}
+
+void Reduction::clearExtremaStart(double *values, int count)
+{
+    switch (instructions()) {
+#if defined(MII_REDUCTION_X86)
+    case AVX:
+        clearExtremaStartAVX(values, count);
+        break;
+    case SSE2:
+        clearExtremaStartSSE2(values, count);
+        break;
+#endif
+    default:
+        clearExtremaStartScalar(values, count);
+    }
+}
+
+}
+}
+}
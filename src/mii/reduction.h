@@ -0,0 +1,83 @@
+/**
+ * GAMS Model Instance Inspector (MII)
+ *
+ * Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef REDUCTION_H
+#define REDUCTION_H
+
+namespace gams {
+namespace studio {
+namespace mii {
+
+///
+/// \brief Vectorized reductions over contiguous values, e.g. the per
+///        equation sweeps of the block pattern scaling statistics.
+/// \remark The instruction set is selected at runtime. SSE2 or AVX are used
+///         on x86 if the CPU supports them, all other platforms use the
+///         scalar implementation.
+///
+class Reduction
+{
+public:
+    enum Instructions
+    {
+        Scalar,
+        SSE2,
+        AVX
+    };
+
+    ///
+    /// \brief Best instruction set supported by the CPU.
+    ///
+    static Instructions supportedInstructions();
+
+    ///
+    /// \brief Instruction set used by the reductions.
+    ///
+    static Instructions instructions();
+
+    ///
+    /// \brief Selects the instruction set used by the reductions, e.g. to
+    ///        compare the implementations.
+    /// \remark Instructions which aren't supported by the CPU are ignored.
+    ///
+    static void setInstructions(Instructions instructions);
+
+    ///
+    /// \brief Minimum of <c>values</c> and <c>initial</c>.
+    ///
+    static double minimum(const double *values, int count, double initial);
+
+    ///
+    /// \brief Maximum of <c>values</c> and <c>initial</c>.
+    ///
+    static double maximum(const double *values, int count, double initial);
+
+    ///
+    /// \brief Replaces <c>lowest()</c> and <c>max()</c> of double, which are
+    ///        used as start values of the extrema, by 0.
+    ///
+    static void clearExtremaStart(double *values, int count);
+};
+
+}
+}
+}
+
+#endif // REDUCTION_H
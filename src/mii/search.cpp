@@ -21,10 +21,16 @@
 #include "search.h"
 #include "common.h"
 #include "abstractmodelinstance.h"
+#include "symbolfiltermodel.h"
 #include "viewconfigurationprovider.h"
 
+#include <algorithm>
+
 #include <QAbstractItemModel>
+#include <QBitArray>
 #include <QRegularExpression>
+#include <QThread>
+#include <QtConcurrent>
 
 #include <QDebug>
 
@@ -38,19 +44,12 @@ Search::Search(const QSharedPointer<AbstractViewConfiguration> &viewConfig,
                bool isRegEx)
     : mViewConfig(viewConfig)
     , mDataModel(dataModel)
+    , mTerm(term)
+    , mIsRegEx(isRegEx)
+    , compare(comparator())
 {
     mViewConfig->searchResult().Term = term;
     mViewConfig->searchResult().IsRegEx = isRegEx;
-    if (isRegEx) {
-        QRegularExpression regex(term);
-        compare = [regex](const QString &text) {
-            return regex.match(text).hasMatch();
-        };
-    } else {
-        compare = [&term](const QString &text) {
-            return text.contains(term, Qt::CaseInsensitive);
-        };
-    }
 }
 
 void Search::run()
@@ -89,31 +88,107 @@ void Search::searchStaticHeader(Qt::Orientation orientation)
 
 void Search::searchHeaderHierarchy(Qt::Orientation orientation)
 {
-    bool ok = false;
-    int sections = orientation == Qt::Horizontal ? mDataModel->columnCount() :
-                                                   mDataModel->rowCount();
-    for (int section=0; section<sections; ++section) {
-        int realSection = mDataModel->headerData(section, orientation).toInt(&ok);
-        if (!ok) continue;
-        searchHeaderHierarchy(section, realSection, orientation);
+    auto modelInstance = mViewConfig->modelInstance();
+    int sectionCount = orientation == Qt::Horizontal ? modelInstance->variableRowCount()
+                                                     : modelInstance->equationRowCount();
+    QBitArray matches(sectionCount);
+    QVector<int> matchedSections;
+    auto match = [&matches, &matchedSections](int section) {
+        if (matches.testBit(section))
+            return;
+        matches.setBit(section);
+        matchedSections.append(section);
+    };
+    const auto &symbols = orientation == Qt::Horizontal ? modelInstance->variables()
+                                                        : modelInstance->equations();
+    for (auto symbol : symbols) {
+        if (symbol->firstSection() < 0 || symbol->lastSection() >= sectionCount ||
+                !compare(symbol->name()))
+            continue;
+        for (int s=symbol->firstSection(); s<=symbol->lastSection(); ++s)
+            match(s);
+    }
+
+    if (mLabelMatches.isEmpty())
+        matchLabels();
+    const auto &index = modelInstance->labelSections(orientation);
+    for (int uel=1; uel<=index.labelCount() && uel<mLabelMatches.size(); ++uel) {
+        if (!mLabelMatches[uel])
+            continue;
+        auto sections = index.sections(uel);
+        for (int i=0; i<index.sectionCount(uel); ++i) {
+            if (sections[i] < sectionCount)
+                match(sections[i]);
+        }
+    }
+
+    auto filterModel = qobject_cast<SymbolFilterModel*>(mDataModel);
+    if (!filterModel) {
+        bool ok = false;
+        int logicalCount = orientation == Qt::Horizontal ? mDataModel->columnCount() :
+                                                           mDataModel->rowCount();
+        for (int section=0; section<logicalCount; ++section) {
+            int realSection = mDataModel->headerData(section, orientation).toInt(&ok);
+            if (!ok || realSection < 0 || realSection >= sectionCount)
+                continue;
+            if (matches.testBit(realSection))
+                mViewConfig->searchResult().Entries.append(SearchResult::SearchEntry{section, orientation});
+        }
+        return;
+    }
+
+    QVector<int> visibleSections;
+    for (int section : std::as_const(matchedSections)) {
+        const auto logicalIndices = modelInstance->logicalIndices(section, orientation,
+                                                                  mViewConfig->viewId());
+        for (int logicalIndex : logicalIndices) {
+            int visibleSection = filterModel->mapSectionFromSource(logicalIndex, orientation);
+            if (visibleSection >= 0)
+                visibleSections.append(visibleSection);
+        }
     }
+    std::sort(visibleSections.begin(), visibleSections.end());
+    visibleSections.erase(std::unique(visibleSections.begin(), visibleSections.end()),
+                          visibleSections.end());
+    for (int section : std::as_const(visibleSections))
+        mViewConfig->searchResult().Entries.append(SearchResult::SearchEntry{section, orientation});
 }
 
-void Search::searchHeaderHierarchy(int logicalIndex, int sectionIndex, Qt::Orientation orientation)
+void Search::matchLabels()
 {
-    auto sym = orientation == Qt::Horizontal ? mViewConfig->modelInstance()->variable(sectionIndex)
-                                             : mViewConfig->modelInstance()->equation(sectionIndex);
-    if (compare(sym->name())) {
-        mViewConfig->searchResult().Entries.append(SearchResult::SearchEntry{logicalIndex, orientation});
-    } else {
-        auto labels = sym->sectionLabels()[sectionIndex];
-        for (const auto& label : labels) {
-            if (compare(label)) {
-                mViewConfig->searchResult().Entries.append(SearchResult::SearchEntry{logicalIndex, orientation});
-                break;
-            }
-        }
+    const auto &labels = mViewConfig->modelInstance()->labels();
+    int labelCount = labels.size();
+    mLabelMatches.fill(0, labelCount+1);
+    char *labelMatches = mLabelMatches.data();
+
+    int workers = std::min(QThread::idealThreadCount(), labelCount / MinParallelLabels);
+    if (workers <= 1) {
+        for (int i=0; i<labelCount; ++i)
+            labelMatches[i+1] = compare(labels[i]);
+        return;
+    }
+    int blockSize = labelCount / workers + 1;
+    QVector<QPair<int, int>> blocks;
+    for (int first=0; first<labelCount; first+=blockSize)
+        blocks.append(qMakePair(first, std::min(first+blockSize, labelCount)));
+    QtConcurrent::blockingMap(blocks, [this, &labels, labelMatches](QPair<int, int> &block) {
+        auto compare = comparator();
+        for (int i=block.first; i<block.second; ++i)
+            labelMatches[i+1] = compare(labels[i]);
+    });
+}
+
+std::function<bool(const QString&)> Search::comparator() const
+{
+    if (mIsRegEx) {
+        QRegularExpression regex(mTerm);
+        return [regex](const QString &text) {
+            return regex.match(text).hasMatch();
+        };
     }
+    return [term=mTerm](const QString &text) {
+        return text.contains(term, Qt::CaseInsensitive);
+    };
 }
 
 }
@@ -24,6 +24,7 @@
 #include <functional>
 #include <QSharedPointer>
 #include <QString>
+#include <QVector>
 
 class QAbstractItemModel;
 
@@ -47,14 +48,40 @@ public:
 
 private:
     void searchStaticHeader(Qt::Orientation orientation);
+
+    ///
+    /// \brief Searches the symbol names and labels of the sections, where
+    ///        the matching sections are taken from the inverted label index.
+    /// \remark For a SymbolFilterModel the matches are mapped to the visible
+    ///         sections, so that the cost depends on the number of matches.
+    ///
     void searchHeaderHierarchy(Qt::Orientation orientation);
-    void searchHeaderHierarchy(int logicalIndex, int sectionIndex,
-                               Qt::Orientation orientation);
+
+    ///
+    /// \brief Evaluates the search term once per label, in parallel for
+    ///        large label tables.
+    ///
+    void matchLabels();
+
+    ///
+    /// \brief Creates the predicate of the search term, where each worker
+    ///        uses an own instance.
+    ///
+    std::function<bool(const QString&)> comparator() const;
 
 private:
+    static const int MinParallelLabels = 4096;
+
     QSharedPointer<AbstractViewConfiguration> mViewConfig;
     QAbstractItemModel *mDataModel;
+    QString mTerm;
+    bool mIsRegEx;
     std::function<bool(const QString&)> compare;
+
+    ///
+    /// \brief Match flag of each UEL index, where index 0 is unused.
+    ///
+    QVector<char> mLabelMatches;
 };
 
 }
@@ -19,7 +19,7 @@
  *
  */
 #include "standardtableviewframe.h"
-#include "identifierfiltermodel.h"
+#include "symbolfiltermodel.h"
 #include "viewconfigurationprovider.h"
 
 #include <QDebug>
@@ -48,8 +48,8 @@ void AbstractStandardTableViewFrame::updateView()
 
 void AbstractStandardTableViewFrame::updateIdentifierFilter()
 {
-    if (mIdentifierFilterModel)
-        mIdentifierFilterModel->setIdentifierFilter(mViewConfig->currentIdentifierFilter());
+    if (mFilterModel)
+        mFilterModel->setIdentifierFilter(mViewConfig->currentIdentifierFilter());
 }
 
 void AbstractStandardTableViewFrame::setIdentifierFilterCheckState(int symbolIndex,
@@ -30,10 +30,7 @@ namespace mii {
 class EquationAttributeTableModel;
 class VariableAttributeTableModel;
 class ColumnRowFilterModel;
-class IdentifierFilterModel;
-class IdentifierLabelFilterModel;
-class ValueFormatProxyModel;
-class LabelFilterModel;
+class SymbolFilterModel;
 class HierarchicalHeaderView;
 class JacobianTableModel;
 
@@ -57,10 +54,7 @@ protected:
                                        Qt::Orientation orientation);
 
 protected:
-    ValueFormatProxyModel* mValueFormatModel = nullptr;
-    IdentifierFilterModel* mIdentifierFilterModel = nullptr;
-    IdentifierLabelFilterModel* mIdentifierLabelFilterModel = nullptr;
-    LabelFilterModel* mLabelFilterModel = nullptr;
+    SymbolFilterModel* mFilterModel = nullptr;
 };
 
 }
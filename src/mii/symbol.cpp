@@ -90,22 +90,74 @@ void Symbol::appendDomainLabel(const QString &label)
     mDomainLabels.push_back(label);
 }
 
-const SectionLabels &Symbol::sectionLabels() const
+QStringList Symbol::sectionLabels(int sectionIndex) const
 {
-    return mSectionLabels;
+    QStringList labels;
+    for (int d=0; d<mDimension; ++d) {
+        auto label = this->label(sectionIndex, d);
+        if (label.isEmpty())
+            return QStringList();
+        labels << label;
+    }
+    return labels;
 }
 
 QString Symbol::label(int sectionIndex, int dimension) const
 {
-    auto data = mSectionLabels[sectionIndex];
-    if (dimension < data.size())
-        return data[dimension];
-    return QString();
+    int uel = labelIndex(sectionIndex, dimension);
+    if (!mLabelTable || uel < 1 || uel > mLabelTable->size())
+        return QString();
+    return mLabelTable->at(uel-1);
 }
 
-void Symbol::setLabels(int sectionIndex, const QStringList &labels)
+int Symbol::labelIndex(int sectionIndex, int dimension) const
 {
-    mSectionLabels[sectionIndex] = labels;
+    loadLabels();
+    if (!contains(sectionIndex) || dimension < 0 || dimension >= mDimension)
+        return 0;
+    int index = (sectionIndex-mFirstSection)*mDimension + dimension;
+    return index < mLabelIndices.size() ? mLabelIndices[index] : 0;
+}
+
+void Symbol::setLabelIndices(int sectionIndex, const int *uels, int count)
+{
+    if (!contains(sectionIndex) || mDimension <= 0)
+        return;
+    if (mLabelIndices.isEmpty())
+        mLabelIndices.fill(0, mEntries*mDimension);
+    int index = (sectionIndex-mFirstSection)*mDimension;
+    std::copy(uels, uels+std::min(count, mDimension), mLabelIndices.begin()+index);
+}
+
+const QStringList *Symbol::labelTable() const
+{
+    return mLabelTable;
+}
+
+void Symbol::setLabelTable(const QStringList *labels)
+{
+    mLabelTable = labels;
+}
+
+void Symbol::setLabelLoader(const std::function<void ()> &loader)
+{
+    mLabelLoader = loader;
+}
+
+void Symbol::loadLabels() const
+{
+    if (mLabelLoader && !mLabelsLoaded.loadAcquire())
+        mLabelLoader();
+}
+
+bool Symbol::labelsLoaded() const
+{
+    return mLabelsLoaded.loadAcquire();
+}
+
+void Symbol::setLabelsLoaded(bool loaded)
+{
+    mLabelsLoaded.storeRelease(loaded);
 }
 
 bool Symbol::contains(int sectionIndex) const
@@ -176,7 +228,8 @@ bool Symbol::operator==(const Symbol &other) const
            mDimension == other.mDimension           &&
            mType == other.mType                     &&
            mDomainLabels == other.mDomainLabels     &&
-           mSectionLabels == other.mSectionLabels   &&
+           mLabelIndices == other.mLabelIndices     &&
+           mLabelTable == other.mLabelTable         &&
            mLabelTree.get() == other.mLabelTree.get();
 }
 
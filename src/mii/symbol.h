@@ -23,9 +23,12 @@
 
 #include "common.h"
 
+#include <QAtomicInt>
 #include <QString>
 #include <QSharedPointer>
 
+#include <functional>
+
 namespace gams {
 namespace studio {
 namespace mii {
@@ -68,11 +71,54 @@ public:
 
     void appendDomainLabel(const QString &label);
 
-    const SectionLabels& sectionLabels() const;
+    ///
+    /// \brief Labels of the given section.
+    /// \return The labels or an empty list if no labels are available.
+    /// \remark The labels are created from the label table on each call.
+    ///
+    QStringList sectionLabels(int sectionIndex) const;
 
     QString label(int sectionIndex, int dimension) const;
 
-    void setLabels(int sectionIndex, const QStringList &labels);
+    ///
+    /// \brief UEL index of the label of <c>sectionIndex</c> and <c>dimension</c>.
+    /// \return The UEL index or <c>0</c> if not available.
+    ///
+    int labelIndex(int sectionIndex, int dimension) const;
+
+    ///
+    /// \brief Sets the UEL indices of the labels of <c>sectionIndex</c>.
+    /// \param sectionIndex Section of the symbol.
+    /// \param uels UEL indices, i.e. a <c>labelTable()</c> position + 1.
+    /// \param count Number of UEL indices, where at most <c>dimension()</c>
+    ///        indices are used.
+    ///
+    void setLabelIndices(int sectionIndex, const int *uels, int count);
+
+    const QStringList* labelTable() const;
+
+    ///
+    /// \brief Sets the label table all UEL indices refer to.
+    /// \remark The table is shared by all symbols, e.g.
+    ///         AbstractModelInstance::labels().
+    ///
+    void setLabelTable(const QStringList *labels);
+
+    ///
+    /// \brief Sets the function which loads the label indices on first use.
+    /// \remark The loader is expected to call setLabelIndices() and
+    ///         setLabelsLoaded().
+    ///
+    void setLabelLoader(const std::function<void()> &loader);
+
+    ///
+    /// \brief Loads the label indices if not done yet.
+    ///
+    void loadLabels() const;
+
+    bool labelsLoaded() const;
+
+    void setLabelsLoaded(bool loaded);
 
     bool contains(int sectionIndex) const;
 
@@ -111,7 +157,13 @@ private:
     Type mType = Unknown;
     int mLogicalIndex = -1;
 
-    SectionLabels mSectionLabels;
+    ///
+    /// \brief UEL indices of all section labels (entries x dimension).
+    ///
+    QVector<int> mLabelIndices;
+    const QStringList *mLabelTable = nullptr;
+    std::function<void()> mLabelLoader;
+    QAtomicInt mLabelsLoaded;
 
     DomainLabels mDomainLabels;
 
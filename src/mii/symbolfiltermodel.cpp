@@ -0,0 +1,384 @@
+/**
+ * GAMS Model Instance Inspector (MII)
+ *
+ * Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "symbolfiltermodel.h"
+#include "abstractmodelinstance.h"
+#include "symbol.h"
+
+#include <QSet>
+
+namespace gams {
+namespace studio {
+namespace mii {
+
+SymbolFilterModel::SymbolFilterModel(const QSharedPointer<AbstractModelInstance> &modelInstance,
+                                     QObject *parent)
+    : QAbstractProxyModel(parent)
+    , mModelInstance(modelInstance)
+{
+
+}
+
+void SymbolFilterModel::setSourceModel(QAbstractItemModel *sourceModel)
+{
+    beginResetModel();
+    if (auto oldModel = this->sourceModel()) {
+        disconnect(oldModel, &QAbstractItemModel::dataChanged,
+                   this, &SymbolFilterModel::sourceDataChanged);
+        disconnect(oldModel, &QAbstractItemModel::headerDataChanged,
+                   this, &SymbolFilterModel::sourceHeaderDataChanged);
+        disconnect(oldModel, &QAbstractItemModel::modelAboutToBeReset,
+                   this, &SymbolFilterModel::beginResetModel);
+        disconnect(oldModel, &QAbstractItemModel::modelReset,
+                   this, &SymbolFilterModel::sourceModelReset);
+    }
+    QAbstractProxyModel::setSourceModel(sourceModel);
+    if (sourceModel) {
+        connect(sourceModel, &QAbstractItemModel::dataChanged,
+                this, &SymbolFilterModel::sourceDataChanged);
+        connect(sourceModel, &QAbstractItemModel::headerDataChanged,
+                this, &SymbolFilterModel::sourceHeaderDataChanged);
+        connect(sourceModel, &QAbstractItemModel::modelAboutToBeReset,
+                this, &SymbolFilterModel::beginResetModel);
+        connect(sourceModel, &QAbstractItemModel::modelReset,
+                this, &SymbolFilterModel::sourceModelReset);
+    }
+    filterSections(Qt::Horizontal);
+    filterSections(Qt::Vertical);
+    endResetModel();
+}
+
+QModelIndex SymbolFilterModel::index(int row, int column, const QModelIndex &parent) const
+{
+    if (parent.isValid() || row < 0 || column < 0 ||
+        row >= mRowMapping.ProxyToSource.size() ||
+        column >= mColumnMapping.ProxyToSource.size())
+        return QModelIndex();
+    return createIndex(row, column);
+}
+
+QModelIndex SymbolFilterModel::parent(const QModelIndex &child) const
+{
+    Q_UNUSED(child);
+    return QModelIndex();
+}
+
+int SymbolFilterModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : mRowMapping.ProxyToSource.size();
+}
+
+int SymbolFilterModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : mColumnMapping.ProxyToSource.size();
+}
+
+QVariant SymbolFilterModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || !sourceModel())
+        return QVariant();
+    auto sourceIndex = mapToSource(index);
+    if (role != Qt::DisplayRole && role != ViewHelper::NumericDataRole)
+        return sourceModel()->data(sourceIndex, role);
+    auto value = sourceModel()->data(sourceIndex, ViewHelper::NumericDataRole).value<NumericValue>();
+    if (value.isSpecial() || !mValueFilter.accepts(value))
+        return QVariant();
+    double result = mValueFilter.UseAbsoluteValues ? std::abs(value.Value) : value.Value;
+    if (role == ViewHelper::NumericDataRole)
+        return QVariant::fromValue(NumericValue(result));
+    return result;
+}
+
+QVariant SymbolFilterModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (!sourceModel())
+        return QVariant();
+    const auto& sections = mapping(orientation).ProxyToSource;
+    if (section >= 0 && section < sections.size())
+        return sourceModel()->headerData(sections[section], orientation, role);
+    if (role == ViewHelper::DimensionRole)
+        return sourceModel()->headerData(section, orientation, role);
+    return QVariant();
+}
+
+QModelIndex SymbolFilterModel::mapToSource(const QModelIndex &proxyIndex) const
+{
+    if (!proxyIndex.isValid() || !sourceModel())
+        return QModelIndex();
+    return sourceModel()->index(mRowMapping.ProxyToSource[proxyIndex.row()],
+                                mColumnMapping.ProxyToSource[proxyIndex.column()]);
+}
+
+QModelIndex SymbolFilterModel::mapFromSource(const QModelIndex &sourceIndex) const
+{
+    if (!sourceIndex.isValid() ||
+        sourceIndex.row() >= mRowMapping.SourceToProxy.size() ||
+        sourceIndex.column() >= mColumnMapping.SourceToProxy.size())
+        return QModelIndex();
+    int row = mRowMapping.SourceToProxy[sourceIndex.row()];
+    int column = mColumnMapping.SourceToProxy[sourceIndex.column()];
+    if (row < 0 || column < 0)
+        return QModelIndex();
+    return createIndex(row, column);
+}
+
+int SymbolFilterModel::mapSectionFromSource(int sourceSection,
+                                            Qt::Orientation orientation) const
+{
+    const auto& sections = mapping(orientation).SourceToProxy;
+    if (sourceSection < 0 || sourceSection >= sections.size())
+        return -1;
+    return sections[sourceSection];
+}
+
+ValueFilter SymbolFilterModel::valueFilter() const
+{
+    return mValueFilter;
+}
+
+void SymbolFilterModel::setValueFilter(const ValueFilter &filter)
+{
+    mValueFilter = filter;
+    if (rowCount() && columnCount()) {
+        emit dataChanged(index(0, 0), index(rowCount()-1, columnCount()-1),
+                         {Qt::DisplayRole, ViewHelper::NumericDataRole});
+    }
+}
+
+LabelFilter SymbolFilterModel::labelFilter() const
+{
+    return mLabelFilter;
+}
+
+void SymbolFilterModel::setLabelFilter(const LabelFilter &filter)
+{
+    mLabelFilter = filter;
+    mColumnFilter = compile(mLabelFilter.LabelCheckStates.value(Qt::Horizontal),
+                            mModelInstance->labels());
+    mRowFilter = compile(mLabelFilter.LabelCheckStates.value(Qt::Vertical),
+                         mModelInstance->labels());
+    beginResetModel();
+    filterSections(Qt::Horizontal);
+    filterSections(Qt::Vertical);
+    endResetModel();
+}
+
+void SymbolFilterModel::setIdentifierFilter(const IdentifierFilter &filter)
+{
+    bool columnsChanged = filter.value(Qt::Horizontal) != mIdentifierFilter.value(Qt::Horizontal);
+    bool rowsChanged = filter.value(Qt::Vertical) != mIdentifierFilter.value(Qt::Vertical);
+    mIdentifierFilter = filter;
+    if (!columnsChanged && !rowsChanged)
+        return;
+    beginResetModel();
+    if (columnsChanged)
+        filterSections(Qt::Horizontal);
+    if (rowsChanged)
+        filterSections(Qt::Vertical);
+    endResetModel();
+}
+
+IdentifierState SymbolFilterModel::identifierState(int symbolIndex,
+                                                   Qt::Orientation orientation) const
+{
+    return mIdentifierStates[orientation].value(symbolIndex);
+}
+
+void SymbolFilterModel::setIdentifierState(const IdentifierState &state,
+                                           Qt::Orientation orientation)
+{
+    mIdentifierStates[orientation][state.SymbolIndex] = state;
+    refilter(orientation);
+}
+
+void SymbolFilterModel::setIdentifierStates(const IdentifierStates &states,
+                                            Qt::Orientation orientation)
+{
+    for (const auto& state : states) {
+        mIdentifierStates[orientation][state.SymbolIndex] = state;
+    }
+    refilter(orientation);
+}
+
+void SymbolFilterModel::clearIdentifierStates()
+{
+    mIdentifierStates.clear();
+}
+
+void SymbolFilterModel::sourceDataChanged(const QModelIndex &topLeft,
+                                          const QModelIndex &bottomRight,
+                                          const QList<int> &roles)
+{
+    if (!rowCount() || !columnCount())
+        return;
+    if (!topLeft.isValid() || !bottomRight.isValid()) {
+        emit dataChanged(index(0, 0), index(rowCount()-1, columnCount()-1), roles);
+        return;
+    }
+    auto proxyRange = [](const QVector<int> &sections, int first, int last) {
+        auto begin = std::lower_bound(sections.constBegin(), sections.constEnd(), first);
+        auto end = std::upper_bound(begin, sections.constEnd(), last);
+        return qMakePair(int(begin-sections.constBegin()), int(end-sections.constBegin())-1);
+    };
+    auto rows = proxyRange(mRowMapping.ProxyToSource, topLeft.row(), bottomRight.row());
+    auto columns = proxyRange(mColumnMapping.ProxyToSource, topLeft.column(), bottomRight.column());
+    if (rows.first > rows.second || columns.first > columns.second)
+        return;
+    emit dataChanged(index(rows.first, columns.first),
+                     index(rows.second, columns.second), roles);
+}
+
+void SymbolFilterModel::sourceHeaderDataChanged(Qt::Orientation orientation, int first, int last)
+{
+    Q_UNUSED(first);
+    Q_UNUSED(last);
+    int count = mapping(orientation).ProxyToSource.size();
+    if (count)
+        emit headerDataChanged(orientation, 0, count-1);
+}
+
+void SymbolFilterModel::sourceModelReset()
+{
+    filterSections(Qt::Horizontal);
+    filterSections(Qt::Vertical);
+    endResetModel();
+}
+
+SymbolFilterModel::UelFilter SymbolFilterModel::compile(const LabelCheckStates &checkStates,
+                                                        const QStringList &labels)
+{
+    UelFilter filter;
+    if (checkStates.isEmpty())
+        return filter;
+    QHash<QString, QPair<bool, bool>> states;
+    for (auto iter=checkStates.constKeyValueBegin();
+         iter!=checkStates.constKeyValueEnd(); ++iter) {
+        auto& state = states[iter->first.toCaseFolded()];
+        if (iter->second == Qt::Checked)
+            state.first = true;
+        else
+            state.second = true;
+    }
+    filter.Checked.resize(labels.size()+1);
+    filter.Unchecked.resize(labels.size()+1);
+    for (int i=0; i<labels.size(); ++i) {
+        auto iter = states.constFind(labels[i].toCaseFolded());
+        if (iter == states.constEnd())
+            continue;
+        filter.Checked.setBit(i+1, iter->first);
+        filter.Unchecked.setBit(i+1, iter->second);
+    }
+    return filter;
+}
+
+bool SymbolFilterModel::matchesAllLabels(const UelFilter &filter,
+                                         const Symbol *symbol,
+                                         int sectionIndex)
+{
+    if (!symbol || filter.Unchecked.isEmpty())
+        return true;
+    for (int d=0; d<symbol->dimension(); ++d) {
+        int uel = symbol->labelIndex(sectionIndex, d);
+        if (uel > 0 && uel < filter.Unchecked.size() && filter.Unchecked.testBit(uel))
+            return false;
+    }
+    return true;
+}
+
+bool SymbolFilterModel::matchesAnyLabels(const UelFilter &filter,
+                                         const Symbol *symbol,
+                                         int sectionIndex)
+{
+    if (!symbol || symbol->isScalar())
+        return true;
+    for (int d=0; d<symbol->dimension(); ++d) {
+        int uel = symbol->labelIndex(sectionIndex, d);
+        if (uel > 0 && uel < filter.Checked.size() && filter.Checked.testBit(uel))
+            return true;
+    }
+    return false;
+}
+
+void SymbolFilterModel::filterSections(Qt::Orientation orientation)
+{
+    auto& sections = mapping(orientation);
+    sections.ProxyToSource.clear();
+    sections.SourceToProxy.clear();
+    if (!sourceModel())
+        return;
+    int count = orientation == Qt::Horizontal ? sourceModel()->columnCount()
+                                              : sourceModel()->rowCount();
+    sections.ProxyToSource.reserve(count);
+    sections.SourceToProxy.fill(-1, count);
+
+    const auto& uelFilter = orientation == Qt::Horizontal ? mColumnFilter : mRowFilter;
+    const auto identifierStates = mIdentifierStates.value(orientation);
+    QSet<QString> uncheckedIdentifiers;
+    for (const auto& state : mIdentifierFilter.value(orientation)) {
+        if (state.Checked != Qt::Checked)
+            uncheckedIdentifiers.insert(state.Text);
+    }
+
+    // sections of a symbol are adjacent, i.e. the identifier states are
+    // only evaluated on a symbol change
+    const Symbol *symbol = nullptr;
+    bool symbolVisible = true;
+    const IndexCheckStates *checkStates = nullptr;
+    for (int s=0; s<count; ++s) {
+        bool ok;
+        int sectionIndex = sourceModel()->headerData(s, orientation).toInt(&ok);
+        if (ok) {
+            auto sym = orientation == Qt::Horizontal ? mModelInstance->variable(sectionIndex)
+                                                     : mModelInstance->equation(sectionIndex);
+            if (sym != symbol) {
+                symbol = sym;
+                symbolVisible = !sym || !uncheckedIdentifiers.contains(sym->name());
+                checkStates = nullptr;
+                auto state = sym ? identifierStates.constFind(sym->firstSection())
+                                 : identifierStates.constEnd();
+                if (state != identifierStates.constEnd() && !state->CheckStates.isEmpty())
+                    checkStates = &state->CheckStates;
+            }
+            if (!symbolVisible)
+                continue;
+            if (mLabelFilter.Any ? !matchesAnyLabels(uelFilter, sym, sectionIndex)
+                                 : !matchesAllLabels(uelFilter, sym, sectionIndex))
+                continue;
+            if (checkStates) {
+                auto state = checkStates->constFind(sectionIndex);
+                if (state != checkStates->constEnd() && *state == Qt::Unchecked)
+                    continue;
+            }
+        }
+        sections.SourceToProxy[s] = sections.ProxyToSource.size();
+        sections.ProxyToSource.append(s);
+    }
+}
+
+void SymbolFilterModel::refilter(Qt::Orientation orientation)
+{
+    beginResetModel();
+    filterSections(orientation);
+    endResetModel();
+}
+
+}
+}
+}
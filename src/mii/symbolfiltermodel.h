@@ -0,0 +1,200 @@
+/**
+ * GAMS Model Instance Inspector (MII)
+ *
+ * Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef SYMBOLFILTERMODEL_H
+#define SYMBOLFILTERMODEL_H
+
+#include <QAbstractProxyModel>
+#include <QBitArray>
+#include <QSharedPointer>
+#include <QVector>
+
+#include "common.h"
+
+namespace gams {
+namespace studio {
+namespace mii {
+
+class AbstractModelInstance;
+class Symbol;
+
+///
+/// \brief Proxy model of the symbol views, which combines the value, label,
+///        identifier and identifier label filters.
+/// \remark The visible rows and columns are evaluated in a single pass per
+///         orientation, where only the orientation of a changed filter is
+///         evaluated again. The value filter only affects the cell data.
+///
+class SymbolFilterModel final : public QAbstractProxyModel
+{
+    Q_OBJECT
+
+public:
+    ///
+    /// \brief Label filter of one orientation compiled to UEL indices.
+    ///
+    struct UelFilter
+    {
+        ///
+        /// \brief UELs which match a checked label.
+        ///
+        QBitArray Checked;
+
+        ///
+        /// \brief UELs which match an unchecked label.
+        ///
+        QBitArray Unchecked;
+    };
+
+    SymbolFilterModel(const QSharedPointer<AbstractModelInstance> &modelInstance,
+                      QObject *parent = nullptr);
+
+    void setSourceModel(QAbstractItemModel *sourceModel) override;
+
+    QModelIndex index(int row, int column,
+                      const QModelIndex &parent = QModelIndex()) const override;
+
+    QModelIndex parent(const QModelIndex &child) const override;
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+
+    QModelIndex mapToSource(const QModelIndex &proxyIndex) const override;
+
+    QModelIndex mapFromSource(const QModelIndex &sourceIndex) const override;
+
+    ///
+    /// \brief Visible section of <c>sourceSection</c> or -1 if it is hidden.
+    ///
+    int mapSectionFromSource(int sourceSection, Qt::Orientation orientation) const;
+
+    ValueFilter valueFilter() const;
+
+    void setValueFilter(const ValueFilter &filter);
+
+    LabelFilter labelFilter() const;
+
+    void setLabelFilter(const LabelFilter &filter);
+
+    void setIdentifierFilter(const IdentifierFilter &filter);
+
+    IdentifierState identifierState(int symbolIndex,
+                                    Qt::Orientation orientation) const;
+
+    void setIdentifierState(const IdentifierState &state,
+                            Qt::Orientation orientation);
+
+    void setIdentifierStates(const IdentifierStates &states,
+                             Qt::Orientation orientation);
+
+    ///
+    /// \brief Removes all identifier label states without evaluating the
+    ///        filters, e.g. before a new label filter is set.
+    ///
+    void clearIdentifierStates();
+
+    ///
+    /// \brief Translates the label check states into UEL bit sets, where
+    ///        labels are compared case insensitive.
+    /// \param labels Label table the UEL indices refer to.
+    ///
+    static UelFilter compile(const LabelCheckStates &checkStates,
+                             const QStringList &labels);
+
+    ///
+    /// \brief Checks that no label of <c>sectionIndex</c> is unchecked.
+    ///
+    static bool matchesAllLabels(const UelFilter &filter, const Symbol *symbol,
+                                 int sectionIndex);
+
+    ///
+    /// \brief Checks that at least one label of <c>sectionIndex</c> is
+    ///        checked, where scalars always match.
+    ///
+    static bool matchesAnyLabels(const UelFilter &filter, const Symbol *symbol,
+                                 int sectionIndex);
+
+private slots:
+    void sourceDataChanged(const QModelIndex &topLeft,
+                           const QModelIndex &bottomRight,
+                           const QList<int> &roles);
+
+    void sourceHeaderDataChanged(Qt::Orientation orientation, int first, int last);
+
+    void sourceModelReset();
+
+private:
+    ///
+    /// \brief Section mapping of one orientation.
+    ///
+    struct SectionMapping
+    {
+        ///
+        /// \brief Source section of each visible section.
+        ///
+        QVector<int> ProxyToSource;
+
+        ///
+        /// \brief Visible section of each source section or -1 if hidden.
+        ///
+        QVector<int> SourceToProxy;
+    };
+
+    ///
+    /// \brief Evaluates all filters of <c>orientation</c> and updates its
+    ///        section mapping.
+    ///
+    void filterSections(Qt::Orientation orientation);
+
+    void refilter(Qt::Orientation orientation);
+
+    SectionMapping& mapping(Qt::Orientation orientation)
+    {
+        return orientation == Qt::Horizontal ? mColumnMapping : mRowMapping;
+    }
+
+    const SectionMapping& mapping(Qt::Orientation orientation) const
+    {
+        return orientation == Qt::Horizontal ? mColumnMapping : mRowMapping;
+    }
+
+private:
+    QSharedPointer<AbstractModelInstance> mModelInstance;
+    ValueFilter mValueFilter;
+    LabelFilter mLabelFilter;
+    UelFilter mColumnFilter;
+    UelFilter mRowFilter;
+    IdentifierFilter mIdentifierFilter;
+    IdentifierFilter mIdentifierStates;
+    SectionMapping mColumnMapping;
+    SectionMapping mRowMapping;
+};
+
+}
+}
+}
+
+#endif // SYMBOLFILTERMODEL_H
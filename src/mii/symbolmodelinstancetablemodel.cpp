@@ -61,6 +61,10 @@ QVariant SymbolModelInstanceTableModel::data(const QModelIndex &index, int role)
     if (role == Qt::DisplayRole && index.isValid()) {
         return mModelInstance->data(index.row(), index.column(), mViewConfig->viewId());
     }
+    if (role == ViewHelper::NumericDataRole && index.isValid()) {
+        auto value = mModelInstance->numericData(index.row(), index.column(), mViewConfig->viewId());
+        return value.Valid ? QVariant::fromValue(value) : QVariant();
+    }
     if (role == ViewHelper::ColumnEntryRole) {
         return mModelInstance->columnEntries(index.column(), mViewConfig->viewId());
     }
@@ -19,14 +19,12 @@
  *
  */
 #include "symbolviewframe.h"
-#include "mii/identifierfiltermodel.h"
-#include "mii/labelfiltermodel.h"
+#include "symbolfiltermodel.h"
 #include "viewconfigurationprovider.h"
 #include "hierarchicalheaderview.h"
 #include "ui_standardtableviewframe.h"
 #include "symbolmodelinstancetablemodel.h"
 #include "abstractmodelinstance.h"
-#include "valueformatproxymodel.h"
 
 namespace gams {
 namespace studio{
@@ -59,14 +57,14 @@ AbstractTableViewFrame *SymbolViewFrame::clone(int viewId)
     frame->updateFilters(AbstractViewConfiguration::ValueConfig |
                          AbstractViewConfiguration::LabelConfig |
                          AbstractViewConfiguration::IdentifierConfig);
-    for (auto iter=mViewConfig->currentIdentifierFilter()[Qt::Horizontal].constBegin();
-         iter!=mViewConfig->currentIdentifierFilter()[Qt::Horizontal].constEnd(); ++iter) {
-        frame->mIdentifierLabelFilterModel->setIdentifierState(*iter, Qt::Horizontal);
+    const auto& horizontalStates = mViewConfig->currentIdentifierFilter()[Qt::Horizontal];
+    frame->mFilterModel->setIdentifierStates(horizontalStates, Qt::Horizontal);
+    for (auto iter=horizontalStates.constBegin(); iter!=horizontalStates.constEnd(); ++iter) {
         frame->mHorizontalHeader->setIdentifierState(*iter);
     }
-    for (auto iter=mViewConfig->currentIdentifierFilter()[Qt::Vertical].constBegin();
-         iter!=mViewConfig->currentIdentifierFilter()[Qt::Vertical].constEnd(); ++iter) {
-        frame->mIdentifierLabelFilterModel->setIdentifierState(*iter, Qt::Vertical);
+    const auto& verticalStates = mViewConfig->currentIdentifierFilter()[Qt::Vertical];
+    frame->mFilterModel->setIdentifierStates(verticalStates, Qt::Vertical);
+    for (auto iter=verticalStates.constBegin(); iter!=verticalStates.constEnd(); ++iter) {
         frame->mVerticalHeader->setIdentifierState(*iter);
     }
     return frame;
@@ -100,15 +98,13 @@ bool SymbolViewFrame::hasData() const
 
 void SymbolViewFrame::updateLabelFilter()
 {
-    if (mLabelFilterModel)
-        mLabelFilterModel->setLabelFilter(mViewConfig->currentLabelFiler());
     if (mHorizontalHeader)
         mHorizontalHeader->resetSymbolLabelFilters();
     if (mVerticalHeader)
         mVerticalHeader->resetSymbolLabelFilters();
-    if (mIdentifierLabelFilterModel) {
-        mIdentifierLabelFilterModel->clearIdentifierFilter();
-        mIdentifierLabelFilterModel->invalidate();
+    if (mFilterModel) {
+        mFilterModel->clearIdentifierStates();
+        mFilterModel->setLabelFilter(mViewConfig->currentLabelFiler());
     }
 }
 
@@ -118,35 +114,48 @@ void SymbolViewFrame::setShowAbsoluteValues(bool absoluteValues)
         return;
     mViewConfig->currentAggregation().setUseAbsoluteValues(absoluteValues);
     mViewConfig->currentValueFilter().UseAbsoluteValues = absoluteValues;
-    mModelInstance->loadViewData(mViewConfig);
-    emit mBaseModel->dataChanged(QModelIndex(), QModelIndex(), {Qt::DisplayRole});
-    mValueFormatModel->setValueFilter(mViewConfig->currentValueFilter());
+    updateValueFilter();
 }
 
 void SymbolViewFrame::setIdentifierLabelFilter(const IdentifierState &state,
                                                Qt::Orientation orientation)
 {
-    if (!mIdentifierLabelFilterModel) {
+    if (!mFilterModel) {
         return;
     }
-    if (state.disabled() && mIdentifierFilterModel) {
+    if (state.disabled()) {
         setIdentifierFilterCheckState(state.SymbolIndex, Qt::Unchecked, orientation);
-        mIdentifierFilterModel->setIdentifierFilter(mViewConfig->currentIdentifierFilter());
+        mFilterModel->setIdentifierFilter(mViewConfig->currentIdentifierFilter());
     } else {
         mViewConfig->currentIdentifierFilter()[orientation][state.SymbolIndex] = state;
-        mIdentifierLabelFilterModel->setIdentifierState(state, orientation);
+        mFilterModel->setIdentifierState(state, orientation);
     }
     updateView();
     emit filtersChanged();
 }
 
+void SymbolViewFrame::updateAggregation()
+{
+    if (mBaseModel && mModelInstance->updateViewData(mViewConfig))
+        mBaseModel->setModelInstance(mModelInstance);
+}
+
+void SymbolViewFrame::updateIdentifierFilter()
+{
+    if (mBaseModel && mModelInstance->updateViewData(mViewConfig))
+        mBaseModel->setModelInstance(mModelInstance);
+    AbstractStandardTableViewFrame::updateIdentifierFilter();
+}
+
 void SymbolViewFrame::updateValueFilter()
 {
     if (!mBaseModel)
         return;
-    mModelInstance->loadViewData(mViewConfig);
-    emit mBaseModel->dataChanged(QModelIndex(), QModelIndex(), {Qt::DisplayRole});
-    mValueFormatModel->setValueFilter(mViewConfig->currentValueFilter());
+    if (mModelInstance->updateViewData(mViewConfig))
+        mBaseModel->setModelInstance(mModelInstance);
+    else
+        emit mBaseModel->dataChanged(QModelIndex(), QModelIndex(), {Qt::DisplayRole});
+    mFilterModel->setValueFilter(mViewConfig->currentValueFilter());
 }
 
 void SymbolViewFrame::setupView()
@@ -167,19 +176,13 @@ void SymbolViewFrame::setupView()
             this, &SymbolViewFrame::setIdentifierLabelFilter);
 
     auto baseModel = new SymbolModelInstanceTableModel(mModelInstance, mViewConfig, ui->tableView);
-    mValueFormatModel = new JacobianValueFormatProxyModel(ui->tableView);
-    mValueFormatModel->setSourceModel(baseModel);
-    mLabelFilterModel = new LabelFilterModel(mModelInstance, ui->tableView);
-    mLabelFilterModel->setSourceModel(mValueFormatModel);
-    mIdentifierFilterModel = new IdentifierFilterModel(mModelInstance, ui->tableView);
-    mIdentifierFilterModel->setSourceModel(mLabelFilterModel);
-    mIdentifierLabelFilterModel = new IdentifierLabelFilterModel(mModelInstance, ui->tableView);
-    mIdentifierLabelFilterModel->setSourceModel(mIdentifierFilterModel);
+    mFilterModel = new SymbolFilterModel(mModelInstance, ui->tableView);
+    mFilterModel->setSourceModel(baseModel);
 
     ui->tableView->setHorizontalHeader(mHorizontalHeader);
     ui->tableView->setVerticalHeader(mVerticalHeader);
     auto oldSelectionModel = ui->tableView->selectionModel();
-    ui->tableView->setModel(mIdentifierLabelFilterModel);
+    ui->tableView->setModel(mFilterModel);
     delete oldSelectionModel;
     mHorizontalHeader->setVisible(true);
     mVerticalHeader->setVisible(true);
@@ -63,6 +63,10 @@ protected slots:
                                   Qt::Orientation orientation) override;
 
 protected:
+    void updateAggregation() override;
+
+    void updateIdentifierFilter() override;
+
     void updateValueFilter() override;
 
 private:
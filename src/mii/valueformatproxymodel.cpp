@@ -40,26 +40,7 @@ void ValueFormatProxyModel::setValueFilter(const ValueFilter &valueFilter)
 PostoptValueFormatProxyModel::PostoptValueFormatProxyModel(QObject *parent)
     : ValueFormatProxyModel(parent)
 {
-    getValue = [](const QVariant &variant, bool *ok) {
-        Q_UNUSED(variant);
-        return variant.toDouble(ok);
-    };
-}
 
-void PostoptValueFormatProxyModel::setValueFilter(const ValueFilter &valueFilter)
-{
-    beginResetModel();
-    mValueFilter = valueFilter;
-    if (mValueFilter.UseAbsoluteValues) {
-        getValue = [](const QVariant &variant, bool *ok) {
-            return std::abs(variant.toDouble(ok));
-        };
-    } else {
-        getValue = [](const QVariant &variant, bool *ok) {
-            return variant.toDouble(ok);
-        };
-    }
-    endResetModel();
 }
 
 QVariant PostoptValueFormatProxyModel::data(const QModelIndex &index, int role) const
@@ -68,79 +49,26 @@ QVariant PostoptValueFormatProxyModel::data(const QModelIndex &index, int role)
         return QVariant();
     if (role != Qt::DisplayRole)
         return QIdentityProxyModel::data(index, role);
-    return applyFilter(QIdentityProxyModel::data(index, role));
-}
-
-QVariant PostoptValueFormatProxyModel::applyFilter(const QVariant &data) const
-{
-    if (!data.isValid())
-        return data;
-    if (!data.toString().compare(ValueHelper::EPSText, Qt::CaseInsensitive)) {
-        if  (mValueFilter.ShowEps)
-            return data;
-        return QVariant();
-    }
-    if (!data.toString().trimmed().compare(ValueHelper::PINFText, Qt::CaseInsensitive)) {
-        if (mValueFilter.ShowPInf)
-            return data;
-        return QVariant();
-    }
-    if (!data.toString().trimmed().compare(ValueHelper::NINFText, Qt::CaseInsensitive)) {
-        if (mValueFilter.ShowNInf)
-            return data;
-        return QVariant();
-    }
-    bool ok = false;
-    double value = getValue(data, &ok);
-    if (ok) {
-        if (!mValueFilter.ExcludeRange && value >= mValueFilter.MinValue && value <= mValueFilter.MaxValue)
-            return value;
-        else if (mValueFilter.ExcludeRange && (value < mValueFilter.MinValue || value > mValueFilter.MaxValue))
-            return value;
-        return QVariant();
-    }
-    return data;
-}
-
-JacobianValueFormatProxyModel::JacobianValueFormatProxyModel(QObject *parent)
-    : ValueFormatProxyModel(parent)
-{
-    getValue = [](const QVariant &variant, bool *ok) {
-        Q_UNUSED(variant);
-        return variant.toDouble(ok);
-    };
-}
-
-void JacobianValueFormatProxyModel::setValueFilter(const ValueFilter &valueFilter)
-{
-    beginResetModel();
-    mValueFilter = valueFilter;
-    if (mValueFilter.UseAbsoluteValues) {
-        getValue = [](const QVariant &variant, bool *ok) {
-            return std::abs(variant.toDouble(ok));
-        };
-    } else {
-        getValue = [](const QVariant &variant, bool *ok) {
-            return variant.toDouble(ok);
-        };
-    }
-    endResetModel();
+    auto value = QIdentityProxyModel::data(index, ViewHelper::NumericDataRole).value<NumericValue>();
+    if (!value.Valid)
+        return QIdentityProxyModel::data(index, role);
+    return applyFilter(value);
 }
 
-QVariant JacobianValueFormatProxyModel::data(const QModelIndex &index, int role) const
+QVariant PostoptValueFormatProxyModel::applyFilter(const NumericValue &value) const
 {
-    if (!index.isValid())
+    switch (value.Type) {
+    case ValueHelper::SpecialValueType::NONE:
+        break;
+    case ValueHelper::SpecialValueType::NA:
+        return ValueHelper::NAText;
+    default:
+        if (mValueFilter.accepts(value))
+            return ValueHelper::specialValueText(value.Type);
         return QVariant();
-    if (role != Qt::DisplayRole)
-        return sourceModel()->data(index, role);
-    bool ok = false;
-    double value = getValue(QIdentityProxyModel::data(index, role), &ok);
-    if (ok) {
-        if (!mValueFilter.ExcludeRange && value >= mValueFilter.MinValue && value <= mValueFilter.MaxValue)
-            return value;
-        else if (mValueFilter.ExcludeRange && (value < mValueFilter.MinValue || value > mValueFilter.MaxValue))
-            return value;
     }
+    if (mValueFilter.accepts(value))
+        return mValueFilter.UseAbsoluteValues ? std::abs(value.Value) : value.Value;
     return QVariant();
 }
 
@@ -156,17 +84,9 @@ QVariant BPValueFormatProxyModel::data(const QModelIndex &index, int role) const
         return QVariant();
     if (role != Qt::DisplayRole)
         return QIdentityProxyModel::data(index, role);
-    bool ok = false;
-    double value = QIdentityProxyModel::data(index, role).toDouble(&ok);
-    if (ok) {
-        double retval = value;
-        if (mValueFilter.UseAbsoluteValues)
-            value = std::abs(value);
-        if (!mValueFilter.ExcludeRange && value >= mValueFilter.MinValue && value <= mValueFilter.MaxValue)
-            return retval;
-        else if (mValueFilter.ExcludeRange && (value < mValueFilter.MinValue || value > mValueFilter.MaxValue))
-            return retval;
-    }
+    auto value = QIdentityProxyModel::data(index, ViewHelper::NumericDataRole).value<NumericValue>();
+    if (mValueFilter.accepts(value))
+        return value.Value;
     return QVariant();
 }
 
@@ -183,17 +103,9 @@ QVariant BPValueFormatTypeProxyModel::data(const QModelIndex &index, int role) c
     if (role != Qt::DisplayRole ||
         index.column() == columnCount()-4 || index.row() == rowCount()-1)
         return QIdentityProxyModel::data(index, role);
-    bool ok = false;
-    double value = QIdentityProxyModel::data(index, role).toDouble(&ok);
-    if (ok) {
-        double retval = value;
-        if (mValueFilter.UseAbsoluteValues)
-            value = std::abs(value);
-        if (!mValueFilter.ExcludeRange && value >= mValueFilter.MinValue && value <= mValueFilter.MaxValue)
-            return retval;
-        else if (mValueFilter.ExcludeRange && (value < mValueFilter.MinValue || value > mValueFilter.MaxValue))
-            return retval;
-    }
+    auto value = QIdentityProxyModel::data(index, ViewHelper::NumericDataRole).value<NumericValue>();
+    if (mValueFilter.accepts(value))
+        return value.Value;
     return QVariant();
 }
 
@@ -207,11 +119,10 @@ QVariant AbsFormatProxyModel::data(const QModelIndex &index, int role) const
 {
     if (!index.isValid())
         return QVariant();
-    if (role == Qt::DisplayRole) {
-        bool ok = false;
-        double value = QIdentityProxyModel::data(index, role).toDouble(&ok);
-        if (ok && mAbsoluteValues)
-            return std::abs(value);
+    if (role == Qt::DisplayRole && mAbsoluteValues) {
+        auto value = QIdentityProxyModel::data(index, ViewHelper::NumericDataRole).value<NumericValue>();
+        if (value.Valid && !value.isSpecial())
+            return std::abs(value.Value);
     }
     return QIdentityProxyModel::data(index, role);
 }
@@ -51,30 +51,10 @@ class PostoptValueFormatProxyModel final : public ValueFormatProxyModel
 public:
     PostoptValueFormatProxyModel(QObject *parent = nullptr);
 
-    void setValueFilter(const ValueFilter &valueFilter) override;
-
-    QVariant data(const QModelIndex &index, int role) const override;
-
-private:
-    QVariant applyFilter(const QVariant &data) const;
-
-private:
-    std::function<double(const QVariant &variant, bool *ok)> getValue;
-};
-
-class JacobianValueFormatProxyModel final : public ValueFormatProxyModel
-{
-    Q_OBJECT
-
-public:
-    JacobianValueFormatProxyModel(QObject *parent = nullptr);
-
-    void setValueFilter(const ValueFilter &valueFilter) override;
-
     QVariant data(const QModelIndex &index, int role) const override;
 
 private:
-    std::function<double(const QVariant &variant, bool *ok)> getValue;
+    QVariant applyFilter(const NumericValue &value) const;
 };
 
 class BPValueFormatProxyModel final : public ValueFormatProxyModel
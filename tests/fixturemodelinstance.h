@@ -0,0 +1,191 @@
+/**
+ * GAMS Model Instance Inspector (MII)
+ *
+ * Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef FIXTUREMODELINSTANCE_H
+#define FIXTUREMODELINSTANCE_H
+
+#include "abstractmodelinstance.h"
+#include "datamatrix.h"
+
+namespace gams {
+namespace studio {
+namespace mii {
+
+///
+/// \brief Model instance with a small Jacobian, i.e. the equations e(i) and
+///        f and the variables x(i,j) and y over the labels a and b.
+///
+///          x(a,a) x(a,b) x(b,a) x(b,b)  y
+///     e(a)   1     -2                   3
+///     e(b)                4     -5
+///     f      6                         -7
+///
+class FixtureModelInstance final : public AbstractModelInstance
+{
+public:
+    FixtureModelInstance()
+        : AbstractModelInstance(".", QString(), QString())
+    {
+        mLabels << "a" << "b";
+        const int one[] = { 1, 2 };
+        const int two[] = { 1, 1, 1, 2, 2, 1, 2, 2 };
+        mEquations << newSymbol("e", Symbol::Equation, 0, 0, 1, 2, one)
+                   << newSymbol("f", Symbol::Equation, 1, 2, 0, 1, nullptr);
+        mVariables << newSymbol("x", Symbol::Variable, 0, 0, 2, 4, two)
+                   << newSymbol("y", Symbol::Variable, 1, 4, 0, 1, nullptr);
+    }
+
+    ~FixtureModelInstance() override
+    {
+        qDeleteAll(mEquations);
+        qDeleteAll(mVariables);
+    }
+
+    int equationCount() const override { return mEquations.size(); }
+    int equationRowCount() const override { return 3; }
+    Symbol* equation(int sectionIndex) const override { return find(mEquations, sectionIndex); }
+    const QVector<Symbol*>& equations() const override { return mEquations; }
+    unsigned char equationType(int row) const override { Q_UNUSED(row); return 0; }
+
+    int variableCount() const override { return mVariables.size(); }
+    int variableRowCount() const override { return 5; }
+    Symbol* variable(int sectionIndex) const override { return find(mVariables, sectionIndex); }
+    const QVector<Symbol*>& variables() const override { return mVariables; }
+    char variableType(int column) const override { Q_UNUSED(column); return 0; }
+
+    void variableLowerBounds(double *bounds) override { std::fill(bounds, bounds+5, 0.0); }
+    void variableUpperBounds(double *bounds) override { std::fill(bounds, bounds+5, 10.0); }
+    double rhs(int row) const override { Q_UNUSED(row); return 0.0; }
+    void equationRhs(double *values) override { std::fill(values, values+3, 0.0); }
+
+    QString longestEquationText() const override { return "e"; }
+    QString longestVariableText() const override { return "x"; }
+    int maximumEquationDimension() const override { return 1; }
+    int maximumVariableDimension() const override { return 2; }
+    double modelMinimum() const override { return -7.0; }
+    double modelMaximum() const override { return 6.0; }
+
+    const QVector<Symbol*>& symbols(Symbol::Type type) const override
+    {
+        return type == Symbol::Equation ? mEquations : mVariables;
+    }
+
+    void loadBaseData() override { }
+    int rowCount(int view) const override { Q_UNUSED(view); return 0; }
+    int rowEntries(int row, int view) const override { Q_UNUSED(row); Q_UNUSED(view); return 0; }
+    int columnCount(int view) const override { Q_UNUSED(view); return 0; }
+    int columnEntries(int column, int view) const override { Q_UNUSED(column); Q_UNUSED(view); return 0; }
+    int symbolRowCount(int view) const override { Q_UNUSED(view); return 0; }
+    int symbolColumnCount(int view) const override { Q_UNUSED(view); return 0; }
+
+    QSharedPointer<AbstractViewConfiguration> clone(int view, int newView) override
+    {
+        Q_UNUSED(view); Q_UNUSED(newView);
+        return nullptr;
+    }
+
+    void loadViewData(QSharedPointer<AbstractViewConfiguration> viewConfig) override { Q_UNUSED(viewConfig); }
+    bool updateViewData(QSharedPointer<AbstractViewConfiguration> viewConfig) override { Q_UNUSED(viewConfig); return false; }
+    QVariant data(int row, int column, int view) const override { Q_UNUSED(row); Q_UNUSED(column); Q_UNUSED(view); return QVariant(); }
+    NumericValue numericData(int row, int column, int view) const override { Q_UNUSED(row); Q_UNUSED(column); Q_UNUSED(view); return NumericValue(); }
+    QSharedPointer<PostoptTreeItem> dataTree(int view) const override { Q_UNUSED(view); return nullptr; }
+
+    QVariant headerData(int logicalIndex, Qt::Orientation orientation, int view, int role) const override
+    {
+        Q_UNUSED(logicalIndex); Q_UNUSED(orientation); Q_UNUSED(view); Q_UNUSED(role);
+        return QVariant();
+    }
+
+    QVariant plainHeaderData(Qt::Orientation orientation, int view, int logicalIndex, int dimension) const override
+    {
+        Q_UNUSED(orientation); Q_UNUSED(view); Q_UNUSED(logicalIndex); Q_UNUSED(dimension);
+        return QVariant();
+    }
+
+    DataMatrix* jacobianData() override
+    {
+        const QVector<QVector<QPair<int, double>>> rows {
+            { {0, 1.0}, {1, -2.0}, {4, 3.0} },
+            { {2, 4.0}, {3, -5.0} },
+            { {0, 6.0}, {4, -7.0} }
+        };
+        auto matrix = new DataMatrix(3, 5, 0);
+        for (int r=0; r<rows.size(); ++r) {
+            matrix->setRowEntries(r, rows[r].size(), 0);
+        }
+        matrix->allocate();
+        for (int r=0; r<rows.size(); ++r) {
+            auto row = matrix->row(r);
+            for (int e=0; e<rows[r].size(); ++e) {
+                row.colIdx()[e] = rows[r][e].first;
+                row.inputData()[e] = rows[r][e].second;
+            }
+        }
+        return matrix;
+    }
+
+    int maxSymbolDimension(int viewId, Qt::Orientation orientation) const override
+    {
+        Q_UNUSED(viewId);
+        return orientation == Qt::Horizontal ? 2 : 1;
+    }
+
+    void removeViewData(int viewId) override { Q_UNUSED(viewId); }
+    void removeViewData() override { }
+
+private:
+    Symbol* newSymbol(const QString &name, Symbol::Type type, int logicalIndex,
+                      int firstSection, int dimension, int entries, const int *uels)
+    {
+        auto symbol = new Symbol;
+        symbol->setName(name);
+        symbol->setType(type);
+        symbol->setLogicalIndex(logicalIndex);
+        symbol->setFirstSection(firstSection);
+        symbol->setOffset(firstSection);
+        symbol->setDimension(dimension);
+        symbol->setEntries(entries);
+        symbol->setLabelTable(&mLabels);
+        for (int s=0; s<entries && uels; ++s) {
+            symbol->setLabelIndices(firstSection+s, uels+s*dimension, dimension);
+        }
+        symbol->setLabelsLoaded(true);
+        return symbol;
+    }
+
+    static Symbol* find(const QVector<Symbol*> &symbols, int sectionIndex)
+    {
+        for (auto symbol : symbols) {
+            if (symbol->contains(sectionIndex))
+                return symbol;
+        }
+        return nullptr;
+    }
+
+private:
+    QVector<Symbol*> mEquations;
+    QVector<Symbol*> mVariables;
+};
+
+}
+}
+}
+
+#endif // FIXTUREMODELINSTANCE_H
@@ -45,6 +45,7 @@ private slots:
 
     void test_default_aggregation();
     void test_getSet_aggregation();
+    void test_median_aggregation();
 
     void test_default_aggregator();
 
@@ -147,6 +148,19 @@ void TestAggregation::test_getSet_aggregation()
     // rest...
 }
 
+void TestAggregation::test_median_aggregation()
+{
+    QCOMPARE(Aggregation::median(nullptr, 0), 0.0);
+    double single[] = {4.2};
+    QCOMPARE(Aggregation::median(single, 1), 4.2);
+    double odd[] = {5, -1, 3, 9, 0};
+    QCOMPARE(Aggregation::median(odd, 5), 3.0);
+    double even[] = {7, 1, 4, 2};
+    QCOMPARE(Aggregation::median(even, 4), 3.0);
+    double equal[] = {2, 2, 2, 2};
+    QCOMPARE(Aggregation::median(equal, 4), 2.0);
+}
+
 void TestAggregation::test_default_aggregator()
 {
 
@@ -0,0 +1,79 @@
+/**
+ * GAMS Model Instance Inspector (MII)
+ *
+ * Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <QtTest>
+
+#include "attributecache.h"
+
+using namespace gams::studio::mii;
+
+class TestAttributeCache : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void test_default();
+    void test_isCached();
+    void test_values();
+};
+
+void TestAttributeCache::test_default()
+{
+    AttributeCache cache;
+    QCOMPARE(cache.size(Qt::Vertical), 0);
+    QCOMPARE(cache.size(Qt::Horizontal), 0);
+    QCOMPARE(cache.value(AttributeHelper::Level, Qt::Vertical, 0), 0.0);
+    QCOMPARE(cache.data(AttributeHelper::Slack, Qt::Horizontal), nullptr);
+}
+
+void TestAttributeCache::test_isCached()
+{
+    QVERIFY(AttributeCache::isCached(AttributeHelper::Level));
+    QVERIFY(AttributeCache::isCached(AttributeHelper::Marginal));
+    QVERIFY(AttributeCache::isCached(AttributeHelper::MarginalNum));
+    QVERIFY(AttributeCache::isCached(AttributeHelper::Lower));
+    QVERIFY(AttributeCache::isCached(AttributeHelper::Upper));
+    QVERIFY(AttributeCache::isCached(AttributeHelper::Scale));
+    QVERIFY(!AttributeCache::isCached(AttributeHelper::Range));
+    QVERIFY(!AttributeCache::isCached(AttributeHelper::Slack));
+    QVERIFY(!AttributeCache::isCached(AttributeHelper::Type));
+    QVERIFY(!AttributeCache::isCached(AttributeHelper::Undefined));
+}
+
+void TestAttributeCache::test_values()
+{
+    AttributeCache cache;
+    cache.resize(2, 3);
+    QCOMPARE(cache.size(Qt::Vertical), 2);
+    QCOMPARE(cache.size(Qt::Horizontal), 3);
+    cache.data(AttributeHelper::Level, Qt::Vertical)[1] = 4.0;
+    cache.data(AttributeHelper::Marginal, Qt::Horizontal)[2] = -2.0;
+    QCOMPARE(cache.value(AttributeHelper::Level, Qt::Vertical, 1), 4.0);
+    QCOMPARE(cache.value(AttributeHelper::Level, Qt::Horizontal, 1), 0.0);
+    QCOMPARE(cache.value(AttributeHelper::Marginal, Qt::Horizontal, 2), -2.0);
+    QCOMPARE(cache.value(AttributeHelper::MarginalNum, Qt::Horizontal, 2), -2.0);
+    QCOMPARE(cache.value(AttributeHelper::Upper, Qt::Vertical, 5), 0.0);
+    cache.resize(2, 3);
+    QCOMPARE(cache.value(AttributeHelper::Level, Qt::Vertical, 1), 0.0);
+}
+
+QTEST_APPLESS_MAIN(TestAttributeCache)
+
+#include "tst_testattributecache.moc"
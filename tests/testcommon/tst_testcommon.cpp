@@ -44,8 +44,10 @@ private slots:
     void test_default_valueFilter();
     void test_getSet_valueFilter();
     void test_minMaxChanged_valueFilter();
+    void test_numericValue_valueFilter();
 
     void test_AttributeHelper_attributeText();
+    void test_AttributeHelper_attributeType();
     void test_AttributeHelper_attributeValue();
     void test_AttributeHelper_static();
 
@@ -53,6 +55,8 @@ private slots:
     void test_SpecialValueHelper_isSpecialValue();
     void test_SpecialValueHelper_static();
 
+    void test_NumericValue_fromVariant();
+
     void test_ViewHelper_isAggregatable();
     void test_ViewHelper_isStandardView();
     void test_ViewHelper_zoomFactor();
@@ -67,19 +71,21 @@ private slots:
 void TestCommon::test_Mi_roleNames()
 {
     auto names = ViewHelper::roleNames();
-    QCOMPARE(names.size(), 6);
+    QCOMPARE(names.size(), 7);
     QVERIFY(names.contains(ViewHelper::ItemDataRole::IndexDataRole));
     QVERIFY(names.contains(ViewHelper::ItemDataRole::LabelDataRole));
     QVERIFY(names.contains(ViewHelper::ItemDataRole::RowEntryRole));
     QVERIFY(names.contains(ViewHelper::ItemDataRole::ColumnEntryRole));
     QVERIFY(names.contains(ViewHelper::ItemDataRole::DimensionRole));
     QVERIFY(names.contains(ViewHelper::ItemDataRole::SectionLabelRole));
+    QVERIFY(names.contains(ViewHelper::ItemDataRole::NumericDataRole));
     QCOMPARE(names[ViewHelper::ItemDataRole::IndexDataRole], "indexdata");
     QCOMPARE(names[ViewHelper::ItemDataRole::LabelDataRole], "labeldata");
     QCOMPARE(names[ViewHelper::ItemDataRole::RowEntryRole], "rowentry");
     QCOMPARE(names[ViewHelper::ItemDataRole::ColumnEntryRole], "columnentry");
     QCOMPARE(names[ViewHelper::ItemDataRole::DimensionRole], "dimension");
     QCOMPARE(names[ViewHelper::ItemDataRole::SectionLabelRole], "sectionlabel");
+    QCOMPARE(names[ViewHelper::ItemDataRole::NumericDataRole], "numericdata");
 }
 
 void TestCommon::test_searchResult()
@@ -297,6 +303,24 @@ void TestCommon::test_minMaxChanged_valueFilter()
     QCOMPARE(filter.minMaxChanged(), false);
 }
 
+void TestCommon::test_numericValue_valueFilter()
+{
+    ValueFilter filter;
+    QVERIFY(!filter.accepts(NumericValue()));
+    QVERIFY(filter.accepts(NumericValue(0.0, ValueHelper::SpecialValueType::EPS)));
+    QVERIFY(filter.accepts(NumericValue(42.0)));
+    QVERIFY(!filter.accepts(NumericValue(0.0, ValueHelper::SpecialValueType::NA)));
+    filter.MinValue = 0;
+    filter.MaxValue = 10;
+    QVERIFY(!filter.accepts(NumericValue(-5.0)));
+    filter.UseAbsoluteValues = true;
+    QVERIFY(filter.accepts(NumericValue(-5.0)));
+    filter.ShowPInf = false;
+    QVERIFY(!filter.accepts(NumericValue(0.0, ValueHelper::SpecialValueType::P_INF)));
+    QVERIFY(filter.accepts(NumericValue(0.0, ValueHelper::SpecialValueType::N_INF)));
+    QVERIFY(filter.accepts(QVariant::fromValue(NumericValue(5.0))));
+}
+
 void TestCommon::test_AttributeHelper_attributeText()
 {
     QCOMPARE(AttributeHelper::attributeText(AttributeHelper::Level), "Level");
@@ -313,6 +337,23 @@ void TestCommon::test_AttributeHelper_attributeText()
     QCOMPARE(AttributeHelper::attributeText(AttributeHelper::Type), "Type");
 }
 
+void TestCommon::test_AttributeHelper_attributeType()
+{
+    QCOMPARE(AttributeHelper::attributeType("Level"), AttributeHelper::Level);
+    QCOMPARE(AttributeHelper::attributeType("marginal"), AttributeHelper::Marginal);
+    QCOMPARE(AttributeHelper::attributeType("MarginalNum"), AttributeHelper::MarginalNum);
+    QCOMPARE(AttributeHelper::attributeType("SLACK LOWER BOUND"), AttributeHelper::SlackLB);
+    QCOMPARE(AttributeHelper::attributeType("Type"), AttributeHelper::Type);
+    QCOMPARE(AttributeHelper::attributeType(QString()), AttributeHelper::Undefined);
+    QCOMPARE(AttributeHelper::attributeType("lvl"), AttributeHelper::Undefined);
+    auto types = AttributeHelper::attributeTypeList();
+    auto texts = AttributeHelper::attributeTextList();
+    QCOMPARE(types.size(), texts.size());
+    for (int i=0; i<types.size(); ++i) {
+        QCOMPARE(AttributeHelper::attributeText(types[i]), texts[i]);
+    }
+}
+
 void TestCommon::test_AttributeHelper_attributeValue()
 {
     double pInf =  1e+299;
@@ -352,6 +393,7 @@ void TestCommon::test_SpecialValueHelper_specialValueText()
     QCOMPARE(ValueHelper::specialValueText(ValueHelper::SpecialValueType::INF), "INF");
     QCOMPARE(ValueHelper::specialValueText(ValueHelper::SpecialValueType::P_INF), "+INF");
     QCOMPARE(ValueHelper::specialValueText(ValueHelper::SpecialValueType::N_INF), "-INF");
+    QCOMPARE(ValueHelper::specialValueText(ValueHelper::SpecialValueType::NONE), QString());
 }
 
 void TestCommon::test_SpecialValueHelper_isSpecialValue()
@@ -375,6 +417,35 @@ void TestCommon::test_SpecialValueHelper_static()
     QCOMPARE(ValueHelper::NINFText, "-INF");
 }
 
+void TestCommon::test_NumericValue_fromVariant()
+{
+    auto value = NumericValue::fromVariant(QVariant());
+    QVERIFY(!value.Valid);
+    value = NumericValue::fromVariant(QString("stuff"));
+    QVERIFY(!value.Valid);
+    value = NumericValue::fromVariant(4.2);
+    QVERIFY(value.Valid);
+    QVERIFY(!value.isSpecial());
+    QCOMPARE(value.Value, 4.2);
+    value = NumericValue::fromVariant(-3);
+    QVERIFY(value.Valid);
+    QCOMPARE(value.Value, -3.0);
+    value = NumericValue::fromVariant(QString::number(0.1));
+    QVERIFY(value.Valid);
+    QCOMPARE(value.Value, 0.1);
+    value = NumericValue::fromVariant(ValueHelper::EPSText);
+    QCOMPARE(value.Type, ValueHelper::SpecialValueType::EPS);
+    value = NumericValue::fromVariant(" " + ValueHelper::PINFText);
+    QCOMPARE(value.Type, ValueHelper::SpecialValueType::P_INF);
+    value = NumericValue::fromVariant(ValueHelper::NINFText);
+    QCOMPARE(value.Type, ValueHelper::SpecialValueType::N_INF);
+    value = NumericValue::fromVariant(ValueHelper::NAText);
+    QCOMPARE(value.Type, ValueHelper::SpecialValueType::NA);
+    value = NumericValue::fromVariant(QVariant::fromValue(NumericValue(1.0, ValueHelper::SpecialValueType::INF)));
+    QVERIFY(value.Valid);
+    QCOMPARE(value.Type, ValueHelper::SpecialValueType::INF);
+}
+
 void TestCommon::test_ViewHelper_isAggregatable()
 {
     QCOMPARE(ViewHelper::isAggregatable(ViewHelper::ViewDataType::BP_Overview), false);
@@ -5,11 +5,17 @@ CONFIG -= app_bundle
 
 TEMPLATE = app
 
-INCLUDEPATH += $$SRCPATH/mii
+INCLUDEPATH += $$SRCPATH/mii \
+               $$TESTSROOT
+
+HEADERS +=  $$TESTSROOT/fixturemodelinstance.h   \
+            $$SRCPATH/mii/symbolfiltermodel.h
 
 SOURCES +=  tst_testdatahandler.cpp                      \
             $$SRCPATH/mii/datahandler.cpp                \
             $$SRCPATH/mii/datamatrix.cpp                 \
+            $$SRCPATH/mii/reduction.cpp                  \
+            $$SRCPATH/mii/symbolfiltermodel.cpp          \
             $$SRCPATH/mii/modelinstance.cpp              \
             $$SRCPATH/mii/abstractmodelinstance.cpp      \
             $$SRCPATH/mii/aggregation.cpp                \
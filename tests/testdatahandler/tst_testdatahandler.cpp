@@ -21,7 +21,8 @@
 #include <QtTest>
 
 #include "datahandler.h"
-#include "abstractmodelinstance.h"
+#include "fixturemodelinstance.h"
+#include "viewconfigurationprovider.h"
 
 using namespace gams::studio::mii;
 
@@ -31,13 +32,28 @@ class TestDataHandler : public QObject
 
 private slots:
     void test_DataHandler_empty();
+
+    void test_CoefficientInfo_blocks();
+    void test_blockPatternViews();
+
+    void test_aggregatedValues_data();
+    void test_aggregatedValues();
+
+    void test_updateData_reuse();
+    void test_updateData_reload();
+
+private:
+    QSharedPointer<AbstractViewConfiguration> symbolsView(const QSharedPointer<AbstractModelInstance> &modelInstance);
+    QSharedPointer<AbstractViewConfiguration> view(ViewHelper::ViewDataType type,
+                                                   const QSharedPointer<AbstractModelInstance> &modelInstance);
 };
 
 void TestDataHandler::test_DataHandler_empty()
 {
     EmptyModelInstance modelInstance;
     DataHandler dataHandler(modelInstance);
-    dataHandler.aggregate(nullptr);
+    dataHandler.loadData(nullptr);
+    QVERIFY(!dataHandler.updateData(nullptr));
     QCOMPARE(dataHandler.data(-4, -2, -1), QVariant());
     QCOMPARE(dataHandler.data(4, 2, -1), QVariant());
     QCOMPARE(dataHandler.data(4, 2, 0), QVariant());
@@ -59,6 +75,249 @@ void TestDataHandler::test_DataHandler_empty()
     dataHandler.loadJacobian();
 }
 
+void TestDataHandler::test_CoefficientInfo_blocks()
+{
+    DataHandler::CoefficientInfo info(3, 4);
+    QCOMPARE(info.equationCount(), 3);
+    QCOMPARE(info.variableCount(), 4);
+    QCOMPARE(info.blockCount(0), 0);
+    info.appendBlocks({0, 2});
+    info.appendBlocks({});
+    info.appendBlocks({1, 2, 3});
+    info.appendBlocks({0});
+    QCOMPARE(info.blockCount(), 5);
+    QCOMPARE(info.blockCount(0), 2);
+    QCOMPARE(info.blockColumns(0)[0], 0);
+    QCOMPARE(info.blockColumns(0)[1], 2);
+    QCOMPARE(info.blockCount(1), 0);
+    QCOMPARE(info.blockCount(2), 3);
+    QCOMPARE(info.blockColumns(2)[0], 1);
+    QCOMPARE(info.blockColumns(2)[2], 3);
+    QCOMPARE(info.blockCount(3), 0);
+    QCOMPARE(info.block(0, 2), 1);
+    QCOMPARE(info.block(0, 1), -1);
+    QCOMPARE(info.block(1, 0), -1);
+    QCOMPARE(info.block(2, 3), 4);
+    info.addCoefficient(4, -1.0, false);
+    info.addCoefficient(4, 0.0, true);
+    info.addCoefficient(4, 2.0, false);
+    info.addCoefficient(4, 3.0, false);
+    QCOMPARE(info.negativeCount(4), 1);
+    QCOMPARE(info.positiveCount(4), 2);
+    QVERIFY(info.nlFlag(2, 3));
+    QVERIFY(!info.nlFlag(2, 2));
+    QVERIFY(!info.nlFlag(1, 3));
+}
+
+void TestDataHandler::test_blockPatternViews()
+{
+    QSharedPointer<AbstractModelInstance> modelInstance(new FixtureModelInstance);
+    DataHandler dataHandler(*modelInstance);
+    dataHandler.loadJacobian();
+    auto scalingView = view(ViewHelper::ViewDataType::BP_Scaling, modelInstance);
+    auto countView = view(ViewHelper::ViewDataType::BP_Count, modelInstance);
+    auto overviewView = view(ViewHelper::ViewDataType::BP_Overview, modelInstance);
+    dataHandler.loadData(scalingView);
+    dataHandler.loadData(countView);
+    dataHandler.loadData(overviewView);
+
+    // blocks (e,x), (e,y), (f,x) and (f,y) with the max/min rows of e and f
+    int viewId = scalingView->viewId();
+    QCOMPARE(dataHandler.rowCount(viewId), 6);
+    QCOMPARE(dataHandler.columnCount(viewId), 4);
+    QCOMPARE(dataHandler.data(0, 0, viewId), QVariant(4.0));
+    QCOMPARE(dataHandler.data(1, 0, viewId), QVariant(-5.0));
+    QCOMPARE(dataHandler.data(1, 1, viewId), QVariant(3.0));
+    QCOMPARE(dataHandler.data(3, 1, viewId), QVariant(-7.0));
+    QCOMPARE(dataHandler.data(1, 3, viewId), QVariant(-5.0));
+    QCOMPARE(dataHandler.data(2, 3, viewId), QVariant(6.0));
+    QCOMPARE(dataHandler.data(4, 0, viewId), QVariant(6.0));
+    QCOMPARE(dataHandler.data(5, 1, viewId), QVariant(-7.0));
+    QCOMPARE(dataHandler.data(0, 2, viewId), QVariant());
+
+    // the counts don't change if the scaling view is loaded again
+    scalingView->currentValueFilter().UseAbsoluteValues = true;
+    QVERIFY(dataHandler.updateData(scalingView));
+    QCOMPARE(dataHandler.data(1, 0, viewId), QVariant(1.0));
+    dataHandler.loadData(countView);
+    viewId = countView->viewId();
+    QCOMPARE(dataHandler.rowCount(viewId), 8);
+    QCOMPARE(dataHandler.columnCount(viewId), 6);
+    QCOMPARE(dataHandler.data(0, 0, viewId), QVariant(2.0));
+    QCOMPARE(dataHandler.data(1, 0, viewId), QVariant(2.0));
+    QCOMPARE(dataHandler.data(0, 1, viewId), QVariant(1.0));
+    QCOMPARE(dataHandler.data(1, 1, viewId), QVariant());
+    QCOMPARE(dataHandler.data(3, 1, viewId), QVariant(1.0));
+    QCOMPARE(dataHandler.data(0, 4, viewId), QVariant(3.0));
+    QCOMPARE(dataHandler.data(1, 4, viewId), QVariant(2.0));
+    QCOMPARE(dataHandler.data(0, 5, viewId), QVariant(2.0));
+    QCOMPARE(dataHandler.data(4, 0, viewId), QVariant(3.0));
+    QCOMPARE(dataHandler.data(5, 1, viewId), QVariant(1.0));
+    QCOMPARE(dataHandler.data(6, 0, viewId), QVariant(4.0));
+
+    viewId = overviewView->viewId();
+    QCOMPARE(dataHandler.rowCount(viewId), 3);
+    QCOMPARE(dataHandler.data(0, 0, viewId), QVariant(double(ValueHelper::Mixed)));
+    QCOMPARE(dataHandler.data(0, 1, viewId), QVariant(double(ValueHelper::Plus)));
+    QCOMPARE(dataHandler.data(1, 0, viewId), QVariant(double(ValueHelper::Plus)));
+    QCOMPARE(dataHandler.data(1, 1, viewId), QVariant(double(ValueHelper::Minus)));
+    QCOMPARE(dataHandler.data(0, 3, viewId), QVariant(double('0')));
+}
+
+void TestDataHandler::test_aggregatedValues_data()
+{
+    QTest::addColumn<int>("type");
+    QTest::addColumn<bool>("absolute");
+    QTest::addColumn<QVector<double>>("values");
+
+    // cells x(a,*) and x(b,*) of e(a), e(b) and f, where 0 is an empty cell
+    QTest::newRow("count") << (int)Aggregation::Count << false << QVector<double>{2, 0, 0, 2, 1, 0};
+    QTest::newRow("sum") << (int)Aggregation::Sum << false << QVector<double>{-1, 0, 0, -1, 6, 0};
+    QTest::newRow("sum_abs") << (int)Aggregation::Sum << true << QVector<double>{3, 0, 0, 9, 6, 0};
+    QTest::newRow("mean") << (int)Aggregation::Mean << false << QVector<double>{-0.5, 0, 0, -0.5, 6, 0};
+    QTest::newRow("median") << (int)Aggregation::Median << false << QVector<double>{-0.5, 0, 0, -0.5, 6, 0};
+    QTest::newRow("minimum") << (int)Aggregation::Minimum << false << QVector<double>{-2, 0, 0, -5, 6, 0};
+    QTest::newRow("maximum") << (int)Aggregation::Maximum << false << QVector<double>{1, 0, 0, 4, 6, 0};
+    QTest::newRow("maximum_abs") << (int)Aggregation::Maximum << true << QVector<double>{2, 0, 0, 5, 6, 0};
+}
+
+void TestDataHandler::test_aggregatedValues()
+{
+    QFETCH(int, type);
+    QFETCH(bool, absolute);
+    QFETCH(QVector<double>, values);
+
+    QSharedPointer<AbstractModelInstance> modelInstance(new FixtureModelInstance);
+    DataHandler dataHandler(*modelInstance);
+    dataHandler.loadJacobian();
+    auto viewConfig = symbolsView(modelInstance);
+    int viewId = viewConfig->viewId();
+    viewConfig->currentIdentifierFilter()[Qt::Horizontal][4].Checked = Qt::Unchecked;
+    AggregationItem item;
+    item.setSymbolIndex(0);
+    item.setCheckState(2, Qt::Checked);
+    viewConfig->currentAggregation().setType(Aggregation::Type(type));
+    viewConfig->currentAggregation().setUseAbsoluteValues(absolute);
+    viewConfig->currentAggregation().setAggregationSymbols(Qt::Horizontal, {{0, item}});
+    dataHandler.loadData(viewConfig);
+
+    QCOMPARE(dataHandler.rowCount(viewId), 3);
+    QCOMPARE(dataHandler.columnCount(viewId), 2);
+    QCOMPARE(dataHandler.headerData(0, Qt::Horizontal, viewId), 0);
+    QCOMPARE(dataHandler.headerData(1, Qt::Horizontal, viewId), 2);
+    QCOMPARE(dataHandler.columnEntries(0, viewId), 2);
+    QCOMPARE(dataHandler.columnEntries(1, viewId), 1);
+    for (int r=0; r<3; ++r) {
+        for (int c=0; c<2; ++c) {
+            auto value = values[r*2+c];
+            QCOMPARE(dataHandler.data(r, c, viewId), value ? QVariant(value) : QVariant());
+        }
+    }
+}
+
+void TestDataHandler::test_updateData_reuse()
+{
+    QSharedPointer<AbstractModelInstance> modelInstance(new FixtureModelInstance);
+    DataHandler dataHandler(*modelInstance);
+    dataHandler.loadJacobian();
+    auto viewConfig = symbolsView(modelInstance);
+    int viewId = viewConfig->viewId();
+    dataHandler.loadData(viewConfig);
+    QCOMPARE(dataHandler.rowCount(viewId), 3);
+    QCOMPARE(dataHandler.columnCount(viewId), 5);
+    QCOMPARE(dataHandler.data(0, 1, viewId), QVariant(-2.0));
+
+    // the value filter is applied to the loaded data
+    viewConfig->currentValueFilter().UseAbsoluteValues = true;
+    QVERIFY(!dataHandler.updateData(viewConfig));
+    QCOMPARE(dataHandler.data(0, 1, viewId), QVariant(2.0));
+    QCOMPARE(viewConfig->currentValueFilter().MinValue, 1.0);
+    QCOMPARE(viewConfig->currentValueFilter().MaxValue, 7.0);
+    viewConfig->currentValueFilter().UseAbsoluteValues = false;
+    QVERIFY(!dataHandler.updateData(viewConfig));
+    QCOMPARE(dataHandler.data(0, 1, viewId), QVariant(-2.0));
+
+    // the same applies to an aggregated view
+    AggregationItem item;
+    item.setSymbolIndex(0);
+    item.setCheckState(2, Qt::Checked);
+    viewConfig->currentAggregation().setType(Aggregation::Sum);
+    viewConfig->currentAggregation().setAggregationSymbols(Qt::Horizontal, {{0, item}});
+    QVERIFY(dataHandler.updateData(viewConfig));
+    QCOMPARE(dataHandler.data(0, 0, viewId), QVariant(-1.0));
+    viewConfig->currentValueFilter().UseAbsoluteValues = true;
+    QVERIFY(!dataHandler.updateData(viewConfig));
+    QCOMPARE(dataHandler.data(0, 0, viewId), QVariant(3.0));
+}
+
+void TestDataHandler::test_updateData_reload()
+{
+    QSharedPointer<AbstractModelInstance> modelInstance(new FixtureModelInstance);
+    DataHandler dataHandler(*modelInstance);
+    dataHandler.loadJacobian();
+    auto viewConfig = symbolsView(modelInstance);
+    int viewId = viewConfig->viewId();
+
+    // an unknown view is loaded
+    QVERIFY(dataHandler.updateData(viewConfig));
+    QCOMPARE(dataHandler.columnCount(viewId), 5);
+
+    // a changed identifier filter changes the sections
+    viewConfig->currentIdentifierFilter()[Qt::Horizontal][4].Checked = Qt::Unchecked;
+    QVERIFY(dataHandler.updateData(viewConfig));
+    QCOMPARE(dataHandler.columnCount(viewId), 4);
+    QVERIFY(!dataHandler.updateData(viewConfig));
+
+    // an active aggregation requires the aggregation provider
+    AggregationItem item;
+    item.setSymbolIndex(0);
+    item.setCheckState(2, Qt::Checked);
+    viewConfig->currentAggregation().setType(Aggregation::Sum);
+    viewConfig->currentAggregation().setAggregationSymbols(Qt::Horizontal, {{0, item}});
+    QVERIFY(dataHandler.updateData(viewConfig));
+    QCOMPARE(dataHandler.columnCount(viewId), 2);
+    QCOMPARE(dataHandler.data(0, 0, viewId), QVariant(-1.0));
+    QVERIFY(!dataHandler.updateData(viewConfig));
+
+    // a changed aggregation type reduces the cells again
+    viewConfig->currentAggregation().setType(Aggregation::Maximum);
+    QVERIFY(dataHandler.updateData(viewConfig));
+    QCOMPARE(dataHandler.data(0, 0, viewId), QVariant(1.0));
+
+    // changed aggregated dimensions unite other sections
+    item.setCheckState(2, Qt::Unchecked);
+    item.setCheckState(1, Qt::Checked);
+    viewConfig->currentAggregation().setAggregationSymbols(Qt::Horizontal, {{0, item}});
+    QVERIFY(dataHandler.updateData(viewConfig));
+    QCOMPARE(dataHandler.data(0, 0, viewId), QVariant(1.0));
+    QCOMPARE(dataHandler.data(0, 1, viewId), QVariant(-2.0));
+    QCOMPARE(dataHandler.data(1, 1, viewId), QVariant(-5.0));
+
+    // an inactive aggregation requires the symbols provider again
+    viewConfig->currentAggregation().setAggregationMap(AggregationMap());
+    QVERIFY(dataHandler.updateData(viewConfig));
+    QCOMPARE(dataHandler.columnCount(viewId), 4);
+    QCOMPARE(dataHandler.data(1, 3, viewId), QVariant(-5.0));
+
+    // a different configuration of the same view is loaded again
+    auto otherConfig = symbolsView(modelInstance);
+    QCOMPARE(otherConfig->viewId(), viewId);
+    QVERIFY(dataHandler.updateData(otherConfig));
+    QCOMPARE(dataHandler.columnCount(viewId), 5);
+}
+
+QSharedPointer<AbstractViewConfiguration> TestDataHandler::symbolsView(const QSharedPointer<AbstractModelInstance> &modelInstance)
+{
+    return view(ViewHelper::ViewDataType::Symbols, modelInstance);
+}
+
+QSharedPointer<AbstractViewConfiguration> TestDataHandler::view(ViewHelper::ViewDataType type,
+                                                                const QSharedPointer<AbstractModelInstance> &modelInstance)
+{
+    return QSharedPointer<AbstractViewConfiguration>(
+                ViewConfigurationProvider::configuration(type, modelInstance));
+}
+
 QTEST_APPLESS_MAIN(TestDataHandler)
 
 #include "tst_testdatahandler.moc"
@@ -12,9 +12,12 @@ private slots:
     void test_DataRow();
     void test_DataRow_inputValue();
     void test_DataRow_outputValue();
+    void test_DataRow_entryIndex();
 
     void test_DataMatrix_defaults();
     void test_DataMatrix();
+    void test_DataMatrix_columnIndex();
+    void test_DataMatrix_clearRows();
 };
 
 void TestDataMatrix::test_DataRow()
@@ -24,150 +27,263 @@ void TestDataMatrix::test_DataRow()
     QCOMPARE(dataRow0.entriesNl(), 0);
     QCOMPARE(dataRow0.colIdx(), nullptr);
     QCOMPARE(dataRow0.inputData(), nullptr);
+    QCOMPARE(dataRow0.outputData(), nullptr);
     QCOMPARE(dataRow0.nlFlags(), nullptr);
-    DataRow dataRow1(8);
-    dataRow1.setEntriesNl(2);
+    int colIdx[8];
+    double inputData[8];
+    double outputData[8];
+    NlFlags::Word nlFlags[1] = {0x2};
+    DataRow dataRow1(8, 2, colIdx, inputData, nullptr, nlFlags);
     QCOMPARE(dataRow1.entries(), 8);
     QCOMPARE(dataRow1.entriesNl(), 2);
-    QVERIFY(dataRow1.colIdx() != nullptr);
-    QVERIFY(dataRow1.inputData() != nullptr);
-    QVERIFY(dataRow1.nlFlags() != nullptr);
-    std::fill(dataRow1.colIdx(), dataRow1.colIdx()+dataRow1.entries(), 1);
-    std::fill(dataRow1.inputData(), dataRow1.inputData()+dataRow1.entries(), 0);
-    std::fill(dataRow1.nlFlags(), dataRow1.nlFlags()+dataRow1.entries(), 0);
-    DataRow dataRow2(dataRow1);
-    QCOMPARE(dataRow2.entries(), dataRow1.entries());
-    QCOMPARE(dataRow2.entriesNl(), 2);
-    QVERIFY(std::equal(dataRow1.colIdx(), dataRow1.colIdx()+dataRow1.entries(), dataRow2.colIdx()));
-    QVERIFY(std::equal(dataRow1.inputData(), dataRow1.inputData()+dataRow1.entries(), dataRow2.inputData()));
-    QVERIFY(std::equal(dataRow1.nlFlags(), dataRow1.nlFlags()+dataRow1.entries(), dataRow2.nlFlags()));
+    QCOMPARE(dataRow1.colIdx(), colIdx);
+    QCOMPARE(dataRow1.inputData(), inputData);
+    QCOMPARE(dataRow1.outputData(), inputData);
+    QCOMPARE(dataRow1.nlFlags(), nlFlags);
+    QVERIFY(!dataRow1.nlFlag(0));
+    QVERIFY(dataRow1.nlFlag(1));
+    DataRow dataRow2(8, 2, colIdx, inputData, outputData, nlFlags);
+    QCOMPARE(dataRow2.inputData(), inputData);
+    QCOMPARE(dataRow2.outputData(), outputData);
     DataRow dataRow3;
     dataRow3 = dataRow2;
     QCOMPARE(dataRow3.entries(), dataRow2.entries());
     QCOMPARE(dataRow3.entriesNl(), 2);
-    QVERIFY(std::equal(dataRow2.colIdx(), dataRow2.colIdx()+dataRow2.entries(), dataRow3.colIdx()));
-    QVERIFY(std::equal(dataRow2.inputData(), dataRow2.inputData()+dataRow2.entries(), dataRow3.inputData()));
-    QVERIFY(std::equal(dataRow2.nlFlags(), dataRow2.nlFlags()+dataRow2.entries(), dataRow3.nlFlags()));
-    DataRow dataRow4 = std::move(dataRow3);
-    //QCOMPARE(dataRow3.entries(), 0);
-    //QCOMPARE(dataRow3.colIdx(), nullptr);
-    //QCOMPARE(dataRow3.inputData(), nullptr);
-    //QCOMPARE(dataRow3.nlFlags(), nullptr);
-    QCOMPARE(dataRow4.entries(), dataRow2.entries());
-    QCOMPARE(dataRow4.entriesNl(), 2);
-    QVERIFY(std::equal(dataRow2.colIdx(), dataRow2.colIdx()+dataRow2.entries(), dataRow4.colIdx()));
-    QVERIFY(std::equal(dataRow2.inputData(), dataRow2.inputData()+dataRow2.entries(), dataRow4.inputData()));
-    QVERIFY(std::equal(dataRow2.nlFlags(), dataRow2.nlFlags()+dataRow2.entries(), dataRow4.nlFlags()));
-    DataRow dataRow5(DataRow(12));
-    QCOMPARE(dataRow5.entries(), 12);
-    QCOMPARE(dataRow5.entriesNl(), 0);
-    QVERIFY(dataRow5.colIdx() != nullptr);
-    QVERIFY(dataRow5.inputData() != nullptr);
-    QVERIFY(dataRow5.nlFlags() != nullptr);
+    QCOMPARE(dataRow3.colIdx(), dataRow2.colIdx());
+    QCOMPARE(dataRow3.inputData(), dataRow2.inputData());
+    QCOMPARE(dataRow3.outputData(), dataRow2.outputData());
+    QCOMPARE(dataRow3.nlFlags(), dataRow2.nlFlags());
 }
 
 void TestDataMatrix::test_DataRow_inputValue()
 {
     DataRow dataRow0;
-    QCOMPARE(dataRow0.inputValue(-1, 10), QVariant());
-    QCOMPARE(dataRow0.inputValue(0, 10), QVariant());
-    QCOMPARE(dataRow0.inputValue(4, 1), QVariant());
-    DataRow dataRow1(4);
-    dataRow1.inputData()[0] = 0;
-    dataRow1.inputData()[1] = 1;
-    dataRow1.inputData()[2] = 2;
-    dataRow1.inputData()[3] = 3;
-    dataRow1.colIdx()[0] = 0;
-    dataRow1.colIdx()[1] = 1;
-    dataRow1.colIdx()[2] = 2;
-    dataRow1.colIdx()[3] = 3;
-    QCOMPARE(dataRow1.inputValue(-1, -4), QVariant());
-    QCOMPARE(dataRow1.inputValue(0, 1).toDouble(), dataRow1.inputData()[0]);
-    QCOMPARE(dataRow1.inputValue(1, 4).toDouble(), dataRow1.inputData()[1]);
-    QCOMPARE(dataRow1.inputValue(2, 5).toDouble(), dataRow1.inputData()[2]);
-    QCOMPARE(dataRow1.inputValue(3, 4).toDouble(), dataRow1.inputData()[3]);
-    QCOMPARE(dataRow1.inputValue(3, -1), QVariant());
+    QVERIFY(!dataRow0.inputValue(-1, 10));
+    QVERIFY(!dataRow0.inputValue(0, 10));
+    QVERIFY(!dataRow0.inputValue(4, 1));
+    int colIdx[] = {0, 1, 2, 3};
+    double inputData[] = {0, 1, 2, 3};
+    NlFlags::Word nlFlags[] = {0};
+    DataRow dataRow1(4, 0, colIdx, inputData, nullptr, nlFlags);
+    QVERIFY(!dataRow1.inputValue(-1, -4));
+    QCOMPARE(*dataRow1.inputValue(0, 1), dataRow1.inputData()[0]);
+    QCOMPARE(*dataRow1.inputValue(1, 4), dataRow1.inputData()[1]);
+    QCOMPARE(*dataRow1.inputValue(2, 5), dataRow1.inputData()[2]);
+    QCOMPARE(*dataRow1.inputValue(3, 4), dataRow1.inputData()[3]);
+    QVERIFY(!dataRow1.inputValue(3, -1));
 }
 
 void TestDataMatrix::test_DataRow_outputValue()
 {
     DataRow dataRow0;
-    QCOMPARE(dataRow0.outputValue(-1, 10), QVariant());
-    QCOMPARE(dataRow0.outputValue(0, 10), QVariant());
-    QCOMPARE(dataRow0.outputValue(4, 1), QVariant());
-    DataRow dataRow1(4);
-    dataRow1.outputData()[0] = 0;
-    dataRow1.outputData()[1] = 1;
-    dataRow1.outputData()[2] = 2;
-    dataRow1.outputData()[3] = 3;
-    dataRow1.colIdx()[0] = 0;
-    dataRow1.colIdx()[1] = 1;
-    dataRow1.colIdx()[2] = 2;
-    dataRow1.colIdx()[3] = 3;
-    QCOMPARE(dataRow1.outputValue(-1, -4), QVariant());
-    QCOMPARE(dataRow1.outputValue(0, 1).toDouble(), dataRow1.outputData()[0]);
-    QCOMPARE(dataRow1.outputValue(1, 4).toDouble(), dataRow1.outputData()[1]);
-    QCOMPARE(dataRow1.outputValue(2, 5).toDouble(), dataRow1.outputData()[2]);
-    QCOMPARE(dataRow1.outputValue(3, 4).toDouble(), dataRow1.outputData()[3]);
-    QCOMPARE(dataRow1.outputValue(3, -1), QVariant());
+    QVERIFY(!dataRow0.outputValue(-1, 10));
+    QVERIFY(!dataRow0.outputValue(0, 10));
+    QVERIFY(!dataRow0.outputValue(4, 1));
+    int colIdx[] = {0, 1, 2, 3};
+    double inputData[] = {4, 5, 6, 7};
+    double outputData[] = {0, 1, 2, 3};
+    NlFlags::Word nlFlags[] = {0};
+    DataRow dataRow1(4, 0, colIdx, inputData, outputData, nlFlags);
+    QVERIFY(!dataRow1.outputValue(-1, -4));
+    QCOMPARE(*dataRow1.outputValue(0, 1), dataRow1.outputData()[0]);
+    QCOMPARE(*dataRow1.outputValue(1, 4), dataRow1.outputData()[1]);
+    QCOMPARE(*dataRow1.outputValue(2, 5), dataRow1.outputData()[2]);
+    QCOMPARE(*dataRow1.outputValue(3, 4), dataRow1.outputData()[3]);
+    QVERIFY(!dataRow1.outputValue(3, -1));
+}
+
+void TestDataMatrix::test_DataRow_entryIndex()
+{
+    DataRow dataRow0;
+    QCOMPARE(dataRow0.entryIndex(0, 10), -1);
+    int colIdx[] = {2, 5, 6, 11};
+    double inputData[] = {0, 1, 2, 3};
+    NlFlags::Word nlFlags[] = {0};
+    DataRow dataRow1(4, 0, colIdx, inputData, nullptr, nlFlags);
+    QCOMPARE(dataRow1.entryIndex(0, 11), -1);
+    QCOMPARE(dataRow1.entryIndex(2, 11), 0);
+    QCOMPARE(dataRow1.entryIndex(4, 11), -1);
+    QCOMPARE(dataRow1.entryIndex(6, 11), 2);
+    QCOMPARE(dataRow1.entryIndex(11, 11), 3);
+    QCOMPARE(dataRow1.entryIndex(12, 11), -1);
+    QCOMPARE(dataRow1.entryIndex(11, 2), -1);
 }
 
 void TestDataMatrix::test_DataMatrix_defaults()
 {
     DataMatrix dataMatrix;
     QCOMPARE(dataMatrix.rowCount(), 0);
-    QCOMPARE(dataMatrix.row(-1), nullptr);
-    QCOMPARE(dataMatrix.row(0), nullptr);
-    QCOMPARE(dataMatrix.row(1), nullptr);
+    QCOMPARE(dataMatrix.row(-1).entries(), 0);
+    QCOMPARE(dataMatrix.row(0).entries(), 0);
+    QCOMPARE(dataMatrix.row(1).colIdx(), nullptr);
     QCOMPARE(dataMatrix.isLinear(), true);
+    QCOMPARE(dataMatrix.isAllocated(), false);
     QCOMPARE(dataMatrix.columnCount(), 0);
+    QCOMPARE(dataMatrix.entries(), 0);
     QCOMPARE(dataMatrix.evalPoint(), nullptr);
+    QCOMPARE(dataMatrix.inputData(), nullptr);
+    QCOMPARE(dataMatrix.outputData(), nullptr);
 }
 
 void TestDataMatrix::test_DataMatrix()
 {
     DataMatrix dataMatrix0;
     QCOMPARE(dataMatrix0.rowCount(), 0);
-    QCOMPARE(dataMatrix0.row(-1), nullptr);
-    QCOMPARE(dataMatrix0.row(0), nullptr);
-    QCOMPARE(dataMatrix0.row(1), nullptr);
+    QCOMPARE(dataMatrix0.row(0).colIdx(), nullptr);
     QCOMPARE(dataMatrix0.columnCount(), 0);
     QCOMPARE(dataMatrix0.evalPoint(), nullptr);
     DataMatrix dataMatrix1(8, 16, 0);
     QCOMPARE(dataMatrix1.rowCount(), 8);
-    QCOMPARE(dataMatrix1.row(-1), nullptr);
-    QVERIFY(dataMatrix1.row(0) != nullptr);
-    QVERIFY(dataMatrix1.row(8) != nullptr);
-    QCOMPARE(dataMatrix1.row(9), nullptr);
     QCOMPARE(dataMatrix1.columnCount(), 16);
     QVERIFY(dataMatrix1.evalPoint() != nullptr);
+    QCOMPARE(dataMatrix1.isAllocated(), false);
+    QCOMPARE(dataMatrix1.row(0).colIdx(), nullptr);
+    for (int r=0; r<dataMatrix1.rowCount(); ++r) {
+        dataMatrix1.setRowEntries(r, r, 0);
+    }
+    dataMatrix1.allocate();
+    QCOMPARE(dataMatrix1.isAllocated(), true);
+    QCOMPARE(dataMatrix1.entries(), 28);
+    QCOMPARE(dataMatrix1.row(-1).colIdx(), nullptr);
+    QCOMPARE(dataMatrix1.row(8).colIdx(), nullptr);
+    QCOMPARE(dataMatrix1.outputData(), dataMatrix1.inputData());
+    for (int r=0; r<dataMatrix1.rowCount(); ++r) {
+        auto row = dataMatrix1.row(r);
+        QCOMPARE(row.entries(), r);
+        QCOMPARE(row.colIdx(), dataMatrix1.row(0).colIdx()+r*(r-1)/2);
+        QCOMPARE(row.outputData(), row.inputData());
+        std::fill(row.colIdx(), row.colIdx()+row.entries(), r);
+        std::fill(row.inputData(), row.inputData()+row.entries(), r);
+        for (int e=0; e<row.entries(); e+=2) {
+            NlFlags::set(row.nlFlags(), e);
+        }
+    }
+    dataMatrix1.setRowEntries(0, 4, 0);
+    QCOMPARE(dataMatrix1.row(0).entries(), 0);
     DataMatrix dataMatrix2(dataMatrix1);
     QCOMPARE(dataMatrix2.rowCount(), 8);
-    QCOMPARE(dataMatrix2.row(-1), nullptr);
-    QVERIFY(dataMatrix2.row(0) != nullptr);
-    QVERIFY(dataMatrix2.row(8) != nullptr);
-    QCOMPARE(dataMatrix2.row(9), nullptr);
     QCOMPARE(dataMatrix2.columnCount(), 16);
+    QCOMPARE(dataMatrix2.entries(), 28);
     QVERIFY(dataMatrix2.evalPoint() != nullptr);
+    QVERIFY(dataMatrix2.inputData() != dataMatrix1.inputData());
+    for (int r=0; r<dataMatrix2.rowCount(); ++r) {
+        auto row1 = dataMatrix1.row(r);
+        auto row2 = dataMatrix2.row(r);
+        QCOMPARE(row2.entries(), row1.entries());
+        QVERIFY(std::equal(row1.colIdx(), row1.colIdx()+row1.entries(), row2.colIdx()));
+        QVERIFY(std::equal(row1.inputData(), row1.inputData()+row1.entries(), row2.inputData()));
+        for (int e=0; e<row1.entries(); ++e) {
+            QCOMPARE(row2.nlFlag(e), row1.nlFlag(e));
+            QCOMPARE(row2.nlFlag(e), e % 2 == 0);
+        }
+    }
     DataMatrix dataMatrix3 = dataMatrix2;
     QCOMPARE(dataMatrix3.rowCount(), dataMatrix2.rowCount());
     QCOMPARE(dataMatrix3.columnCount(), dataMatrix2.columnCount());
+    QCOMPARE(dataMatrix3.entries(), dataMatrix2.entries());
     DataMatrix dataMatrix4 = std::move(dataMatrix3);
-    //QCOMPARE(dataMatrix3.rowCount(), 0);
-    //QCOMPARE(dataMatrix3.row(0), nullptr);
+    QCOMPARE(dataMatrix3.rowCount(), 0);
+    QCOMPARE(dataMatrix3.row(0).colIdx(), nullptr);
     QCOMPARE(dataMatrix4.rowCount(), 8);
-    QVERIFY(dataMatrix4.row(8) != nullptr);
+    QCOMPARE(dataMatrix4.row(7).entries(), 7);
     QCOMPARE(dataMatrix4.columnCount(), 16);
     QVERIFY(dataMatrix4.evalPoint() != nullptr);
-    DataMatrix dataMatrix5(DataMatrix(12, 8, 0));
+    DataMatrix dataMatrix5(DataMatrix(12, 8, 1));
     QCOMPARE(dataMatrix5.rowCount(), 12);
-    QVERIFY(dataMatrix5.row(0) != nullptr);
-    QVERIFY(dataMatrix5.row(12) != nullptr);
-    QVERIFY(dataMatrix5.row(13) == nullptr);
+    QCOMPARE(dataMatrix5.isLinear(), false);
+    dataMatrix5.setRowEntries(11, 3, 1);
+    dataMatrix5.allocate();
+    QCOMPARE(dataMatrix5.row(11).entries(), 3);
+    QCOMPARE(dataMatrix5.row(11).entriesNl(), 1);
+    QVERIFY(dataMatrix5.row(11).outputData() != dataMatrix5.row(11).inputData());
+    QCOMPARE(dataMatrix5.row(12).colIdx(), nullptr);
     QCOMPARE(dataMatrix5.columnCount(), 8);
     QVERIFY(dataMatrix5.evalPoint() != nullptr);
 }
 
+void TestDataMatrix::test_DataMatrix_columnIndex()
+{
+    DataMatrix dataMatrix0;
+    QCOMPARE(dataMatrix0.columnEntries(-1), 0);
+    QCOMPARE(dataMatrix0.columnEntries(0), 0);
+    QCOMPARE(dataMatrix0.columnRows(0), nullptr);
+    QCOMPARE(dataMatrix0.columnOffsets(0), nullptr);
+    DataMatrix dataMatrix1(3, 4, 0);
+    dataMatrix1.setRowEntries(0, 2, 0);
+    dataMatrix1.setRowEntries(1, 2, 0);
+    dataMatrix1.setRowEntries(2, 1, 0);
+    dataMatrix1.allocate();
+    dataMatrix1.row(0).colIdx()[0] = 0;
+    dataMatrix1.row(0).colIdx()[1] = 2;
+    dataMatrix1.row(1).colIdx()[0] = 1;
+    dataMatrix1.row(1).colIdx()[1] = 2;
+    dataMatrix1.row(2).colIdx()[0] = 3;
+    QVERIFY(!dataMatrix1.hasColumnIndex());
+    QCOMPARE(dataMatrix1.columnEntries(0), 0);
+    QCOMPARE(dataMatrix1.columnRows(0), nullptr);
+    dataMatrix1.buildColumnIndex();
+    QVERIFY(dataMatrix1.hasColumnIndex());
+    QCOMPARE(dataMatrix1.columnEntries(0), 1);
+    QCOMPARE(dataMatrix1.columnEntries(1), 1);
+    QCOMPARE(dataMatrix1.columnEntries(2), 2);
+    QCOMPARE(dataMatrix1.columnEntries(3), 1);
+    QCOMPARE(dataMatrix1.columnEntries(4), 0);
+    QCOMPARE(dataMatrix1.columnRows(2)[0], 0);
+    QCOMPARE(dataMatrix1.columnRows(2)[1], 1);
+    QCOMPARE(dataMatrix1.columnOffsets(2)[0], 1);
+    QCOMPARE(dataMatrix1.columnOffsets(2)[1], 3);
+    QCOMPARE(dataMatrix1.columnRows(3)[0], 2);
+    QCOMPARE(dataMatrix1.columnOffsets(3)[0], 4);
+    DataMatrix dataMatrix2(dataMatrix1);
+    QCOMPARE(dataMatrix2.columnEntries(2), 2);
+    QCOMPARE(dataMatrix2.columnRows(2)[1], 1);
+    DataMatrix dataMatrix3 = std::move(dataMatrix2);
+    QCOMPARE(dataMatrix3.columnEntries(0), 1);
+    QCOMPARE(dataMatrix3.columnRows(0)[0], 0);
+    dataMatrix3.row(2).colIdx()[0] = 0;
+    dataMatrix3.buildColumnIndex();
+    QCOMPARE(dataMatrix3.columnEntries(0), 2);
+    QCOMPARE(dataMatrix3.columnRows(0)[1], 2);
+    QCOMPARE(dataMatrix3.columnEntries(3), 0);
+}
+
+void TestDataMatrix::test_DataMatrix_clearRows()
+{
+    DataMatrix dataMatrix(4, 8, 1);
+    for (int r=0; r<dataMatrix.rowCount(); ++r)
+        dataMatrix.setRowEntries(r, r+1, 1);
+    dataMatrix.allocate();
+    for (int r=0; r<dataMatrix.rowCount(); ++r) {
+        auto row = dataMatrix.row(r);
+        for (int e=0; e<row.entries(); ++e) {
+            row.colIdx()[e] = e;
+            row.inputData()[e] = r;
+            row.outputData()[e] = -r;
+            NlFlags::set(row.nlFlags(), e, e == r);
+        }
+    }
+    dataMatrix.buildColumnIndex();
+    dataMatrix.clearRows({1, 5});
+    QVERIFY(!dataMatrix.hasColumnIndex());
+    QCOMPARE(dataMatrix.entries(), 8);
+    QCOMPARE(dataMatrix.row(1).entries(), 0);
+    QCOMPARE(dataMatrix.row(1).entriesNl(), 0);
+    for (int r : {0, 2, 3}) {
+        auto row = dataMatrix.row(r);
+        QCOMPARE(row.entries(), r+1);
+        QCOMPARE(row.entriesNl(), 1);
+        for (int e=0; e<row.entries(); ++e) {
+            QCOMPARE(row.colIdx()[e], e);
+            QCOMPARE(row.inputData()[e], double(r));
+            QCOMPARE(row.outputData()[e], double(-r));
+            QCOMPARE(row.nlFlag(e), e == r);
+        }
+    }
+    dataMatrix.buildColumnIndex();
+    QCOMPARE(dataMatrix.columnEntries(0), 3);
+    QCOMPARE(dataMatrix.columnRows(1)[0], 2);
+}
+
 QTEST_APPLESS_MAIN(TestDataMatrix)
 
 #include "tst_testdatamatrix.moc"
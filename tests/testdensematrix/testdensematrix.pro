@@ -0,0 +1,14 @@
+include(../tests.pri)
+
+QT -= gui
+
+CONFIG += qt console warn_on depend_includepath testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+INCLUDEPATH += $$SRCPATH/mii
+
+HEADERS +=  $$SRCPATH/mii/densematrix.h
+
+SOURCES +=  tst_testdensematrix.cpp
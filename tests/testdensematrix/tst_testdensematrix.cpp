@@ -0,0 +1,108 @@
+/**
+ * GAMS Model Instance Inspector (MII)
+ *
+ * Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <QtTest>
+
+#include "densematrix.h"
+
+using namespace gams::studio::mii;
+
+class TestDenseMatrix : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void test_default();
+    void test_rowMajor();
+    void test_copyOnWrite();
+    void test_move();
+};
+
+void TestDenseMatrix::test_default()
+{
+    DenseMatrix<int> matrix;
+    QCOMPARE(matrix.rowCount(), 0);
+    QCOMPARE(matrix.columnCount(), 0);
+    QCOMPARE(matrix.size(), 0);
+    QVERIFY(!matrix.isShared());
+}
+
+void TestDenseMatrix::test_rowMajor()
+{
+    DenseMatrix<double> matrix(3, 4, 1.5);
+    QCOMPARE(matrix.rowCount(), 3);
+    QCOMPARE(matrix.columnCount(), 4);
+    QCOMPARE(matrix.size(), 12);
+    for (int i=0; i<matrix.size(); ++i) {
+        QCOMPARE(matrix.data()[i], 1.5);
+    }
+    auto cells = matrix.cells();
+    cells[1][2] = 42.0;
+    cells[2][0] = -1.0;
+    const auto& constMatrix = matrix;
+    QCOMPARE(constMatrix.data()[1*4+2], 42.0);
+    QCOMPARE(constMatrix.data()[2*4], -1.0);
+    QCOMPARE(constMatrix[1]+4, constMatrix[2]);
+    QCOMPARE(cells[1], constMatrix[1]);
+    matrix.fill(0.0);
+    QCOMPARE(constMatrix[1][2], 0.0);
+}
+
+void TestDenseMatrix::test_copyOnWrite()
+{
+    DenseMatrix<int> matrix0(2, 3, 7);
+    DenseMatrix<int> matrix1(matrix0);
+    QVERIFY(matrix0.isShared());
+    QVERIFY(matrix1.isShared());
+    const auto& constMatrix = matrix1;
+    QCOMPARE(constMatrix[1][2], 7);
+    QVERIFY(matrix1.isShared());
+    auto cells = matrix1.cells();
+    QVERIFY(!matrix0.isShared());
+    QVERIFY(!matrix1.isShared());
+    cells[1][2] = 3;
+    cells[0][1] = 4;
+    QCOMPARE(std::as_const(matrix0)[1][2], 7);
+    QCOMPARE(constMatrix[1][2], 3);
+    QCOMPARE(constMatrix[0][1], 4);
+    QCOMPARE(constMatrix[0][0], 7);
+    matrix0 = matrix1;
+    QVERIFY(matrix0.isShared());
+    QCOMPARE(std::as_const(matrix0)[1][2], 3);
+}
+
+void TestDenseMatrix::test_move()
+{
+    DenseMatrix<char> matrix0(2, 2, 'a');
+    DenseMatrix<char> matrix1(std::move(matrix0));
+    QCOMPARE(matrix0.rowCount(), 0);
+    QCOMPARE(matrix0.columnCount(), 0);
+    QCOMPARE(matrix1.rowCount(), 2);
+    QCOMPARE(std::as_const(matrix1)[1][1], 'a');
+    DenseMatrix<char> matrix2;
+    matrix2 = std::move(matrix1);
+    QCOMPARE(matrix1.size(), 0);
+    QCOMPARE(std::as_const(matrix2)[0][1], 'a');
+    QVERIFY(!matrix2.isShared());
+}
+
+QTEST_APPLESS_MAIN(TestDenseMatrix)
+
+#include "tst_testdensematrix.moc"
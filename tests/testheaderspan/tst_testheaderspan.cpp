@@ -0,0 +1,106 @@
+/**
+ * GAMS Model Instance Inspector (MII)
+ *
+ * Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <QtTest>
+
+#include "headerspan.h"
+
+using namespace gams::studio::mii;
+
+class TestHeaderSpan : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void test_empty();
+    void test_noSymbol();
+    void test_symbolRuns();
+    void test_parentLabel();
+
+private:
+    ///
+    /// \brief Span table with unset spans and the given <c>labels</c>.
+    ///
+    static QVector<HeaderSpan> spanTable(const QVector<int> &labels);
+
+    static QVector<int> spans(const QVector<HeaderSpan> &table, int cell, int stride);
+};
+
+void TestHeaderSpan::test_empty()
+{
+    QVector<HeaderSpan> table;
+    HeaderSpans::merge(table, QVector<int>(), 2);
+    QVERIFY(table.isEmpty());
+}
+
+void TestHeaderSpan::test_noSymbol()
+{
+    auto table = spanTable({0, 0,
+                            0, 0});
+    HeaderSpans::merge(table, {-1, -1}, 2);
+    QCOMPARE(spans(table, 0, 2), QVector<int>({1, 1}));
+    QCOMPARE(spans(table, 1, 2), QVector<int>({1, 1}));
+}
+
+void TestHeaderSpan::test_symbolRuns()
+{
+    // two symbols, where the first starts at section 0
+    auto table = spanTable({0, 1,
+                            0, 1,
+                            0, 2,
+                            3, 2,
+                            3, 2});
+    HeaderSpans::merge(table, {0, 0, 0, 3, 3}, 2);
+    QCOMPARE(spans(table, 0, 2), QVector<int>({3, 0, 0, 2, 0}));
+    QCOMPARE(spans(table, 1, 2), QVector<int>({2, 0, 1, 2, 0}));
+}
+
+void TestHeaderSpan::test_parentLabel()
+{
+    // the second dimension is only merged if the first one is
+    auto table = spanTable({0, 1, 5,
+                            0, 1, 5,
+                            0, 2, 5,
+                            0, 2, 6});
+    HeaderSpans::merge(table, {0, 0, 0, 0}, 3);
+    QCOMPARE(spans(table, 0, 3), QVector<int>({4, 0, 0, 0}));
+    QCOMPARE(spans(table, 1, 3), QVector<int>({2, 0, 2, 0}));
+    QCOMPARE(spans(table, 2, 3), QVector<int>({2, 0, 1, 1}));
+}
+
+QVector<HeaderSpan> TestHeaderSpan::spanTable(const QVector<int> &labels)
+{
+    QVector<HeaderSpan> table;
+    for (int label : labels)
+        table.append({-1, label});
+    return table;
+}
+
+QVector<int> TestHeaderSpan::spans(const QVector<HeaderSpan> &table, int cell, int stride)
+{
+    QVector<int> result;
+    for (int i=cell; i<table.size(); i+=stride)
+        result.append(table[i].Span);
+    return result;
+}
+
+QTEST_APPLESS_MAIN(TestHeaderSpan)
+
+#include "tst_testheaderspan.moc"
@@ -0,0 +1,14 @@
+include(../tests.pri)
+
+CONFIG += qt console warn_on depend_includepath testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+INCLUDEPATH += $$SRCPATH/mii
+
+SOURCES +=  tst_testlabelfiltertree.cpp                 \
+            $$SRCPATH/mii/filtertreeitem.cpp            \
+            $$SRCPATH/mii/labelfiltertree.cpp           \
+            $$SRCPATH/mii/labeltreeitem.cpp             \
+            $$SRCPATH/mii/symbol.cpp
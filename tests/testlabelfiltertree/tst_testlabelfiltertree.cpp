@@ -0,0 +1,234 @@
+/**
+ * GAMS Model Instance Inspector (MII)
+ *
+ * Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <QtTest>
+
+#include "filtertreeitem.h"
+#include "labelfiltertree.h"
+#include "symbol.h"
+
+using namespace gams::studio::mii;
+
+class TestLabelFilterTree : public QObject
+{
+    Q_OBJECT
+
+public:
+    TestLabelFilterTree();
+
+private slots:
+    void test_unfiltered();
+    void test_partiallyFiltered();
+    void test_missingLabels();
+
+private:
+    ///
+    /// \brief Symbol with the sorted label tuples of <c>records</c>, which
+    ///        are UEL indices of <c>mLabels</c>.
+    ///
+    void setupSymbol(Symbol &symbol, const QVector<QVector<int>> &records);
+
+    ///
+    /// \brief Reference of the former recursive two pass construction.
+    ///
+    static FilterTreeItem* twoPassTree(const Symbol &symbol,
+                                       const IdentifierState &filter,
+                                       const QSet<int> &visibleSections);
+
+    static void labelFilterTree(const QString &label,
+                                const QMap<int, QStringList> &data,
+                                const IdentifierState &state,
+                                const QSet<int> &visibleSections,
+                                int symbolIndex,
+                                FilterTreeItem *parent);
+
+    static void compareTrees(FilterTreeItem *actual, FilterTreeItem *expected);
+
+    static const QVector<QVector<int>> Records;
+
+private:
+    QStringList mLabels;
+};
+
+const QVector<QVector<int>> TestLabelFilterTree::Records {
+    {1, 4, 6}, {1, 4, 7}, {1, 5, 6}, {2, 4, 6}, {2, 4, 7},
+    {2, 5, 7}, {3, 4, 6}, {3, 5, 6}, {3, 5, 7}
+};
+
+TestLabelFilterTree::TestLabelFilterTree()
+    : mLabels({"i1", "i2", "i3", "j1", "j2", "k1", "k2"})
+{
+
+}
+
+void TestLabelFilterTree::test_unfiltered()
+{
+    Symbol symbol;
+    setupSymbol(symbol, Records);
+    QSet<int> visibleSections;
+    for (int s=symbol.firstSection(); s<=symbol.lastSection(); ++s)
+        visibleSections.insert(s);
+
+    QScopedPointer<FilterTreeItem> actual(LabelFilterTree::create(&symbol, IdentifierState(), visibleSections));
+    QScopedPointer<FilterTreeItem> expected(twoPassTree(symbol, IdentifierState(), visibleSections));
+    QCOMPARE(actual->rowCount(), 3);
+    QCOMPARE(actual->child(0)->rowCount(), 2);
+    QCOMPARE(actual->child(0)->child(0)->rowCount(), 2);
+    compareTrees(actual.get(), expected.get());
+}
+
+void TestLabelFilterTree::test_partiallyFiltered()
+{
+    Symbol symbol;
+    setupSymbol(symbol, Records);
+    // i1.j2.*, i2.*.k2 and i3.j2.k2 are hidden by the view
+    QSet<int> visibleSections;
+    for (int s : {0, 1, 3, 6, 7})
+        visibleSections.insert(symbol.firstSection()+s);
+    IdentifierState filter;
+    filter.SymbolIndex = symbol.firstSection();
+    filter.SectionIndex = symbol.firstSection();
+    filter.CheckStates[symbol.firstSection()+1] = Qt::Unchecked;
+    filter.CheckStates[symbol.firstSection()+3] = Qt::Unchecked;
+    filter.CheckStates[symbol.firstSection()+6] = Qt::Checked;
+    filter.CheckStates[symbol.firstSection()+7] = Qt::Unchecked;
+
+    QScopedPointer<FilterTreeItem> actual(LabelFilterTree::create(&symbol, filter, visibleSections));
+    QScopedPointer<FilterTreeItem> expected(twoPassTree(symbol, filter, visibleSections));
+    compareTrees(actual.get(), expected.get());
+    QVERIFY(!actual->child(0)->child(1)->isEnabled());
+    QCOMPARE(actual->child(1)->checked(), Qt::Unchecked);
+}
+
+void TestLabelFilterTree::test_missingLabels()
+{
+    Symbol symbol;
+    setupSymbol(symbol, {{1, 4, 6}, {1, 0, 7}, {1, 4, 7}, {2, 5, 6}});
+    QSet<int> visibleSections { symbol.firstSection(), symbol.firstSection()+2 };
+
+    QScopedPointer<FilterTreeItem> actual(LabelFilterTree::create(&symbol, IdentifierState(), visibleSections));
+    QScopedPointer<FilterTreeItem> expected(twoPassTree(symbol, IdentifierState(), visibleSections));
+    compareTrees(actual.get(), expected.get());
+    QCOMPARE(actual->child(0)->child(0)->rowCount(), 2);
+}
+
+void TestLabelFilterTree::setupSymbol(Symbol &symbol, const QVector<QVector<int>> &records)
+{
+    symbol.setName("x");
+    symbol.setEntries(records.size());
+    symbol.setDimension(records.first().size());
+    symbol.setFirstSection(10);
+    symbol.setLabelTable(&mLabels);
+    for (int r=0; r<records.size(); ++r)
+        symbol.setLabelIndices(symbol.firstSection()+r, records[r].constData(), records[r].size());
+    symbol.setLabelsLoaded(true);
+}
+
+FilterTreeItem* TestLabelFilterTree::twoPassTree(const Symbol &symbol,
+                                                 const IdentifierState &filter,
+                                                 const QSet<int> &visibleSections)
+{
+    auto root = new FilterTreeItem;
+    root->setCheckable(false);
+    root->setSymbolIndex(symbol.firstSection());
+    root->setSectionIndex(symbol.firstSection());
+    root->setText(symbol.name());
+
+    QString label;
+    QMap<int, QStringList> subData;
+    for (int section=symbol.firstSection(); section<=symbol.lastSection(); ++section) {
+        auto subLabels = symbol.sectionLabels(section);
+        if (subLabels.isEmpty()) {
+            continue;
+        }
+        if (label.isEmpty()) {
+            label = subLabels.takeFirst();
+            subData[section] = subLabels;
+        } else if (label == subLabels.first()) {
+            subLabels.removeFirst();
+            subData[section] = subLabels;
+        } else {
+            labelFilterTree(label, subData, filter, visibleSections, symbol.firstSection(), root);
+            label = subLabels.takeFirst();
+            subData.clear();
+            subData[section] = subLabels;
+        }
+    }
+    labelFilterTree(label, subData, filter, visibleSections, symbol.firstSection(), root);
+    return root;
+}
+
+void TestLabelFilterTree::labelFilterTree(const QString &label,
+                                          const QMap<int, QStringList> &data,
+                                          const IdentifierState &state,
+                                          const QSet<int> &visibleSections,
+                                          int symbolIndex,
+                                          FilterTreeItem *parent)
+{
+    if (data.isEmpty() || label.isEmpty()) return;
+    bool enabled = parent->parent() ? visibleSections.contains(data.firstKey()) : true;
+    auto checkState = Qt::Checked;
+    if (state.isValid() && state.CheckStates.contains(data.firstKey()))
+        checkState = state.CheckStates[data.firstKey()];
+    auto labelItem = new FilterTreeItem(label, enabled ? checkState : Qt::Unchecked, parent);
+    labelItem->setSectionIndex(data.firstKey());
+    labelItem->setEnabled(enabled);
+    labelItem->setSymbolIndex(symbolIndex);
+    parent->append(labelItem);
+
+    QString subLabel;
+    QMap<int, QStringList> subData;
+    for (auto iter=data.keyValueBegin(); iter!=data.keyValueEnd(); ++iter) {
+        auto subLabels = iter->second;
+        if (subLabels.isEmpty()) {
+            continue;
+        }
+        if (subLabel.isEmpty()) {
+            subLabel = subLabels.takeFirst();
+            subData[iter->first] = subLabels;
+        } else if (subLabel == subLabels.first()) {
+            subLabels.removeFirst();
+            subData[iter->first] = subLabels;
+        } else {
+            labelFilterTree(subLabel, subData, state, visibleSections, symbolIndex, labelItem);
+            subLabel = subLabels.takeFirst();
+            subData.clear();
+            subData[iter->first] = subLabels;
+        }
+    }
+    labelFilterTree(subLabel, subData, state, visibleSections, symbolIndex, labelItem);
+}
+
+void TestLabelFilterTree::compareTrees(FilterTreeItem *actual, FilterTreeItem *expected)
+{
+    QCOMPARE(actual->text(), expected->text());
+    QCOMPARE(actual->checked(), expected->checked());
+    QCOMPARE(actual->isEnabled(), expected->isEnabled());
+    QCOMPARE(actual->isCheckable(), expected->isCheckable());
+    QCOMPARE(actual->sectionIndex(), expected->sectionIndex());
+    QCOMPARE(actual->symbolIndex(), expected->symbolIndex());
+    QCOMPARE(actual->rowCount(), expected->rowCount());
+    for (int i=0; i<actual->rowCount(); ++i)
+        compareTrees(actual->child(i), expected->child(i));
+}
+
+QTEST_APPLESS_MAIN(TestLabelFilterTree)
+
+#include "tst_testlabelfiltertree.moc"
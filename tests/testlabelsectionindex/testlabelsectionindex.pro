@@ -0,0 +1,14 @@
+include(../tests.pri)
+
+CONFIG += qt console warn_on depend_includepath testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+INCLUDEPATH += $$SRCPATH/mii
+
+HEADERS +=  $$SRCPATH/mii/labelsectionindex.h
+
+SOURCES +=  $$SRCPATH/mii/symbol.cpp        \
+            $$SRCPATH/mii/labeltreeitem.cpp \
+            tst_testlabelsectionindex.cpp
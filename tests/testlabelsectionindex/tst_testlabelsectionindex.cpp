@@ -0,0 +1,94 @@
+/**
+ * GAMS Model Instance Inspector (MII)
+ *
+ * Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <QtTest>
+
+#include "labelsectionindex.h"
+
+using namespace gams::studio::mii;
+
+class TestLabelSectionIndex : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void test_default();
+    void test_build();
+};
+
+void TestLabelSectionIndex::test_default()
+{
+    LabelSectionIndex index;
+    QVERIFY(index.isEmpty());
+    QCOMPARE(index.labelCount(), 0);
+    QCOMPARE(index.sectionCount(1), 0);
+    QCOMPARE(index.sections(1), nullptr);
+}
+
+void TestLabelSectionIndex::test_build()
+{
+    // x(i,j) with sections 0..2 and y(i) with sections 3..4
+    Symbol x;
+    x.setFirstSection(0);
+    x.setEntries(3);
+    x.setDimension(2);
+    int xLabels[] = { 1, 2,
+                      1, 1,
+                      3, 2 };
+    for (int s=0; s<3; ++s)
+        x.setLabelIndices(s, xLabels + s*2, 2);
+    x.setLabelsLoaded(true);
+
+    Symbol y;
+    y.setFirstSection(3);
+    y.setEntries(2);
+    y.setDimension(1);
+    int yLabels[] = { 2, 4 };
+    for (int s=0; s<2; ++s)
+        y.setLabelIndices(3+s, yLabels + s, 1);
+    y.setLabelsLoaded(true);
+
+    LabelSectionIndex index;
+    index.build({ &x, &y }, 4);
+    QVERIFY(!index.isEmpty());
+    QCOMPARE(index.labelCount(), 4);
+
+    QCOMPARE(index.sectionCount(1), 2);
+    QCOMPARE(index.sections(1)[0], 0);
+    QCOMPARE(index.sections(1)[1], 1);
+
+    QCOMPARE(index.sectionCount(2), 3);
+    QCOMPARE(index.sections(2)[0], 0);
+    QCOMPARE(index.sections(2)[1], 2);
+    QCOMPARE(index.sections(2)[2], 3);
+
+    QCOMPARE(index.sectionCount(3), 1);
+    QCOMPARE(index.sections(3)[0], 2);
+
+    QCOMPARE(index.sectionCount(4), 1);
+    QCOMPARE(index.sections(4)[0], 4);
+
+    QCOMPARE(index.sectionCount(0), 0);
+    QCOMPARE(index.sectionCount(5), 0);
+}
+
+QTEST_APPLESS_MAIN(TestLabelSectionIndex)
+
+#include "tst_testlabelsectionindex.moc"
@@ -21,6 +21,7 @@
 #include <QtTest>
 
 #include "modelinstance.h"
+#include "datamatrix.h"
 
 using namespace gams::studio::mii;
 
@@ -32,6 +33,17 @@ private slots:
     void test_constructor_initialize();
     void test_default();
     void test_getSet();
+    void test_jacobianData_parallel_data();
+    void test_jacobianData_parallel();
+
+private:
+    ///
+    /// \brief Solves a small nonlinear model with the GAMS found in the
+    ///        <c>PATH</c>, which keeps the scratch files in <c>scratchDir</c>.
+    /// \return The GAMS system directory or an empty string if GAMS is not
+    ///         available.
+    ///
+    QString solveFixtureModel(const QString &workDir, const QString &scratchDir);
 };
 
 void TestModelInstance::test_constructor_initialize()
@@ -86,6 +98,81 @@ void TestModelInstance::test_getSet()
     QCOMPARE(instance.globalAbsolute(), true);
 }
 
+void TestModelInstance::test_jacobianData_parallel_data()
+{
+    QTest::addColumn<bool>("useOutput");
+
+    QTest::newRow("input")  << false;
+    QTest::newRow("output") << true;
+}
+
+void TestModelInstance::test_jacobianData_parallel()
+{
+    QFETCH(bool, useOutput);
+
+    QTemporaryDir workDir;
+    QVERIFY(workDir.isValid());
+    QString scratchDir = workDir.filePath("scratch");
+    auto systemDir = solveFixtureModel(workDir.path(), scratchDir);
+    if (systemDir.isEmpty())
+        QSKIP("GAMS is not available");
+
+    ModelInstance instance(useOutput, workDir.path(), systemDir, scratchDir);
+    QCOMPARE(instance.state(), AbstractModelInstance::Valid);
+    instance.loadBaseData();
+    QCOMPARE(instance.state(), AbstractModelInstance::Valid);
+
+    instance.setJacobianWorkers(1);
+    QScopedPointer<DataMatrix> serial(instance.jacobianData());
+    instance.setJacobianWorkers(4);
+    QScopedPointer<DataMatrix> parallel(instance.jacobianData());
+    QCOMPARE(instance.state(), AbstractModelInstance::Valid);
+    QVERIFY(!serial->isLinear());
+
+    QCOMPARE(parallel->rowCount(), serial->rowCount());
+    QCOMPARE(parallel->columnCount(), serial->columnCount());
+    QCOMPARE(parallel->entries(), serial->entries());
+    for (int r=0; r<serial->rowCount(); ++r) {
+        auto serialRow = serial->row(r);
+        auto parallelRow = parallel->row(r);
+        QCOMPARE(parallelRow.entries(), serialRow.entries());
+        QCOMPARE(parallelRow.entriesNl(), serialRow.entriesNl());
+        for (int e=0; e<serialRow.entries(); ++e) {
+            QCOMPARE(parallelRow.colIdx()[e], serialRow.colIdx()[e]);
+            QCOMPARE(parallelRow.nlFlag(e), serialRow.nlFlag(e));
+            QCOMPARE(parallelRow.inputData()[e], serialRow.inputData()[e]);
+            QCOMPARE(parallelRow.outputData()[e], serialRow.outputData()[e]);
+        }
+    }
+}
+
+QString TestModelInstance::solveFixtureModel(const QString &workDir, const QString &scratchDir)
+{
+    auto gams = QStandardPaths::findExecutable("gams");
+    if (gams.isEmpty())
+        return QString();
+    QFile model(workDir + "/fixture.gms");
+    if (!model.open(QIODevice::WriteOnly | QIODevice::Text))
+        return QString();
+    model.write("Set i / i1*i40 /;\n"
+                "Variable x(i), z;\n"
+                "x.lo(i) = 0.1; x.up(i) = 10; x.l(i) = ord(i)/10;\n"
+                "Equation e(i), obj;\n"
+                "e(i).. sqr(x(i)) + exp(x(i)/10)*x(i--1) =g= 1;\n"
+                "obj.. z =e= sum(i, sqr(x(i)) + x(i)*x(i++1));\n"
+                "Model m / all /;\n"
+                "solve m using nlp minimizing z;\n");
+    model.close();
+    QDir().mkpath(scratchDir);
+
+    QProcess process;
+    process.setWorkingDirectory(workDir);
+    process.start(gams, { model.fileName(), "lo=0", "keep=1", "scrdir=" + scratchDir });
+    if (!process.waitForFinished(60000) || process.exitCode())
+        return QString();
+    return QFileInfo(QFileInfo(gams).canonicalFilePath()).absolutePath();
+}
+
 QTEST_APPLESS_MAIN(TestModelInstance)
 
 #include "tst_testmodelinstance.moc"
@@ -0,0 +1,15 @@
+include(../tests.pri)
+
+QT -= gui
+
+CONFIG += qt console warn_on depend_includepath testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+INCLUDEPATH += $$SRCPATH/mii
+
+HEADERS +=  $$SRCPATH/mii/densematrix.h            \
+            $$SRCPATH/mii/nlflags.h
+
+SOURCES +=  tst_testnlflags.cpp
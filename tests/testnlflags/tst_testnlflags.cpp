@@ -0,0 +1,153 @@
+/**
+ * GAMS Model Instance Inspector (MII)
+ *
+ * Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <QtTest>
+
+#include "nlflags.h"
+
+using namespace gams::studio::mii;
+
+class TestNlFlags : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void test_words();
+    void test_testSet();
+    void test_pack();
+
+    void test_NlFlagMatrix_default();
+    void test_NlFlagMatrix();
+    void test_NlFlagMatrix_uniteRow();
+};
+
+void TestNlFlags::test_words()
+{
+    QCOMPARE(NlFlags::words(-1), 0);
+    QCOMPARE(NlFlags::words(0), 0);
+    QCOMPARE(NlFlags::words(1), 1);
+    QCOMPARE(NlFlags::words(64), 1);
+    QCOMPARE(NlFlags::words(65), 2);
+}
+
+void TestNlFlags::test_testSet()
+{
+    NlFlags::Word words[2] = {0, 0};
+    NlFlags::set(words, 0);
+    NlFlags::set(words, 63);
+    NlFlags::set(words, 64);
+    QVERIFY(NlFlags::test(words, 0));
+    QVERIFY(!NlFlags::test(words, 1));
+    QVERIFY(NlFlags::test(words, 63));
+    QVERIFY(NlFlags::test(words, 64));
+    QVERIFY(!NlFlags::test(words, 127));
+    NlFlags::set(words, 63, false);
+    QVERIFY(!NlFlags::test(words, 63));
+    QVERIFY(NlFlags::test(words, 64));
+}
+
+void TestNlFlags::test_pack()
+{
+    int flags[70];
+    std::fill(flags, flags+70, 0);
+    flags[2] = 1;
+    flags[69] = 1;
+    NlFlags::Word words[2] = {~NlFlags::Word(0), ~NlFlags::Word(0)};
+    NlFlags::pack(flags, 70, words);
+    for (int i=0; i<70; ++i) {
+        QCOMPARE(NlFlags::test(words, i), flags[i] != 0);
+    }
+}
+
+void TestNlFlags::test_NlFlagMatrix_default()
+{
+    NlFlagMatrix matrix;
+    QCOMPARE(matrix.rowCount(), 0);
+    QCOMPARE(matrix.columnCount(), 0);
+}
+
+void TestNlFlags::test_NlFlagMatrix()
+{
+    NlFlagMatrix matrix0(3, 70);
+    QCOMPARE(matrix0.rowCount(), 3);
+    QCOMPARE(matrix0.columnCount(), 70);
+    for (int r=0; r<matrix0.rowCount(); ++r) {
+        for (int c=0; c<matrix0.columnCount(); ++c) {
+            QVERIFY(!matrix0.test(r, c));
+        }
+    }
+    auto flags0 = matrix0.flags();
+    flags0.set(1, 69);
+    flags0.unite(2, 0, false);
+    flags0.unite(2, 1, true);
+    QVERIFY(matrix0.test(1, 69));
+    QVERIFY(!matrix0.test(2, 0));
+    QVERIFY(matrix0.test(2, 1));
+    QVERIFY(!matrix0.test(0, 69));
+    NlFlagMatrix matrix1(matrix0);
+    QVERIFY(matrix1.test(1, 69));
+    QVERIFY(matrix0.isShared());
+    QVERIFY(matrix1.isShared());
+    matrix1.flags().set(1, 69, false);
+    QVERIFY(!matrix0.isShared());
+    QVERIFY(!matrix1.isShared());
+    QVERIFY(!matrix1.test(1, 69));
+    QVERIFY(matrix0.test(1, 69));
+    NlFlagMatrix matrix2 = std::move(matrix0);
+    QCOMPARE(matrix0.rowCount(), 0);
+    QCOMPARE(matrix2.rowCount(), 3);
+    QVERIFY(matrix2.test(2, 1));
+    matrix1 = matrix2;
+    QVERIFY(matrix1.test(1, 69));
+}
+
+void TestNlFlags::test_NlFlagMatrix_uniteRow()
+{
+    NlFlagMatrix matrix0(2, 70);
+    auto flags0 = matrix0.flags();
+    flags0.set(0, 3);
+    flags0.set(0, 66);
+    flags0.set(1, 69);
+    NlFlagMatrix matrix1(2, 68);
+    auto flags1 = matrix1.flags();
+    flags1.set(0, 1);
+    flags1.uniteRow(0, matrix0, 0);
+    flags1.uniteRow(1, matrix0, 1);
+    QVERIFY(matrix1.test(0, 1));
+    QVERIFY(matrix1.test(0, 3));
+    QVERIFY(matrix1.test(0, 66));
+    QVERIFY(!matrix1.test(0, 67));
+    for (int c=0; c<matrix1.columnCount(); ++c) {
+        QVERIFY(!matrix1.test(1, c));
+    }
+    NlFlagMatrix matrix2(1, 140);
+    matrix2.flags().uniteRow(0, matrix0, 1);
+    QVERIFY(matrix2.test(0, 69));
+    QVERIFY(!matrix2.test(0, 3));
+    NlFlagMatrix matrix3(matrix0);
+    matrix3.flags().uniteRow(1, matrix1, 0);
+    QVERIFY(matrix3.test(1, 3));
+    QVERIFY(!matrix0.test(1, 3));
+    QVERIFY(!matrix0.isShared());
+}
+
+QTEST_APPLESS_MAIN(TestNlFlags)
+
+#include "tst_testnlflags.moc"
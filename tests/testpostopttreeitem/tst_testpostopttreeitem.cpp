@@ -34,6 +34,8 @@ private slots:
 
     void test_LinePostoptTreeItem_default();
     void test_LinePostoptTreeItem_get_set();
+
+    void test_PostoptTreeItem_fetchChildren();
 };
 
 void TestPostoptTreeItem::test_GroupPostoptTreeItem_default()
@@ -111,6 +113,36 @@ void TestPostoptTreeItem::test_LinePostoptTreeItem_get_set()
     delete root;
 }
 
+void TestPostoptTreeItem::test_PostoptTreeItem_fetchChildren()
+{
+    GroupPostoptTreeItem root("G1");
+    QVERIFY(!root.hasChildren());
+    QVERIFY(!root.canFetchMore());
+    QVERIFY(root.fetchChildren().isEmpty());
+    int calls = 0;
+    root.setLoader([&calls](PostoptTreeItem*) {
+        ++calls;
+        return QVector<PostoptTreeItem*> { new LinePostoptTreeItem({"L1"}),
+                                           new LinePostoptTreeItem({"L2"}) };
+    });
+    QVERIFY(root.hasChildren());
+    QVERIFY(root.canFetchMore());
+    QCOMPARE(root.rowCount(), 0);
+    auto children = root.fetchChildren();
+    QCOMPARE(calls, 1);
+    QCOMPARE(children.size(), 2);
+    QVERIFY(!root.canFetchMore());
+    QVERIFY(!root.hasChildren());
+    QVERIFY(root.fetchChildren().isEmpty());
+    QCOMPARE(calls, 1);
+    for (auto child : children)
+        root.append(child);
+    QVERIFY(root.hasChildren());
+    QCOMPARE(root.child(1)->data(0).toString(), "L2");
+    QCOMPARE(root.child(1)->parent(), &root);
+    QCOMPARE(root.child(1)->row(), 1);
+}
+
 QTEST_APPLESS_MAIN(TestPostoptTreeItem)
 
 #include "tst_testpostopttreeitem.moc"
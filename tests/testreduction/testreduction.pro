@@ -0,0 +1,15 @@
+include(../tests.pri)
+
+QT -= gui
+
+CONFIG += qt console warn_on depend_includepath testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+INCLUDEPATH += $$SRCPATH/mii
+
+HEADERS +=  $$SRCPATH/mii/reduction.h
+
+SOURCES +=  tst_testreduction.cpp               \
+            $$SRCPATH/mii/reduction.cpp
@@ -0,0 +1,133 @@
+/**
+ * GAMS Model Instance Inspector (MII)
+ *
+ * Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <QtTest>
+
+#include "reduction.h"
+
+#include <limits>
+#include <vector>
+
+using namespace gams::studio::mii;
+
+class TestReduction : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void cleanup();
+
+    void test_instructions();
+    void test_extrema();
+    void test_clearExtremaStart();
+
+private:
+    ///
+    /// \brief Deterministic values with negative numbers and extrema start values.
+    ///
+    static std::vector<double> values(int count, int seed);
+
+    ///
+    /// \brief Instruction sets supported by the CPU.
+    ///
+    static std::vector<Reduction::Instructions> instructions();
+};
+
+void TestReduction::cleanup()
+{
+    Reduction::setInstructions(Reduction::supportedInstructions());
+}
+
+void TestReduction::test_instructions()
+{
+    QCOMPARE(Reduction::instructions(), Reduction::supportedInstructions());
+    Reduction::setInstructions(Reduction::Scalar);
+    QCOMPARE(Reduction::instructions(), Reduction::Scalar);
+    if (Reduction::supportedInstructions() != Reduction::AVX) {
+        Reduction::setInstructions(Reduction::AVX);
+        QCOMPARE(Reduction::instructions(), Reduction::Scalar);
+    }
+}
+
+void TestReduction::test_extrema()
+{
+    for (auto set : instructions()) {
+        Reduction::setInstructions(set);
+        for (int count=0; count<19; ++count) {
+            auto data = values(count, 3);
+            double min = 5.0, max = -5.0;
+            for (int i=0; i<count; ++i) {
+                min = std::min(min, data[i]);
+                max = std::max(max, data[i]);
+            }
+            QCOMPARE(Reduction::minimum(data.data(), count, 5.0), min);
+            QCOMPARE(Reduction::maximum(data.data(), count, -5.0), max);
+        }
+    }
+}
+
+void TestReduction::test_clearExtremaStart()
+{
+    for (auto set : instructions()) {
+        Reduction::setInstructions(set);
+        for (int count=0; count<19; ++count) {
+            auto data = values(count, 4);
+            auto original = data;
+            Reduction::clearExtremaStart(data.data(), count);
+            for (int i=0; i<count; ++i) {
+                if (original[i] == std::numeric_limits<double>::lowest() ||
+                    original[i] == std::numeric_limits<double>::max()) {
+                    QCOMPARE(data[i], 0.0);
+                } else {
+                    QCOMPARE(data[i], original[i]);
+                }
+            }
+        }
+    }
+}
+
+std::vector<double> TestReduction::values(int count, int seed)
+{
+    std::vector<double> values(count);
+    for (int i=0; i<count; ++i) {
+        int v = (i * 7 + seed * 13) % 11;
+        if (v == 3)
+            values[i] = std::numeric_limits<double>::lowest();
+        else if (v == 7)
+            values[i] = std::numeric_limits<double>::max();
+        else
+            values[i] = (v - 5) * 1.25 * seed;
+    }
+    return values;
+}
+
+std::vector<Reduction::Instructions> TestReduction::instructions()
+{
+    std::vector<Reduction::Instructions> sets;
+    for (auto set : { Reduction::Scalar, Reduction::SSE2, Reduction::AVX }) {
+        if (set <= Reduction::supportedInstructions())
+            sets.push_back(set);
+    }
+    return sets;
+}
+
+QTEST_APPLESS_MAIN(TestReduction)
+
+#include "tst_testreduction.moc"
@@ -18,7 +18,7 @@
 # along with this program. If not, see <http://www.gnu.org/licenses/>.
 #
 
-QT += core gui widgets testlib
+QT += core gui widgets testlib concurrent
 
 CONFIG += c++17
 CONFIG -= app_bundle
@@ -22,14 +22,22 @@ TEMPLATE = subdirs
 
 SUBDIRS +=                          \
     testaggregation                 \
+    testattributecache              \
     testcommon                      \
     testdatahandler                 \
     testdatamatrix                  \
+    testdensematrix                 \
     testemptymodelinstance          \
     testfiltertreeitem              \
+    testheaderspan                  \
+    testlabelfiltertree             \
+    testlabelsectionindex           \
     testlabeltreeitem               \
     testmodelinstance               \
+    testnlflags                     \
     testpostopttreeitem             \
+    testreduction                   \
     testsectiontreeitem             \
     testsymbol                      \
+    testsymbolfiltermodel           \
     testviewconfigurationprovider
@@ -7,11 +7,15 @@ TEMPLATE = app
 
 INCLUDEPATH += $$SRCPATH/mii
 
+HEADERS +=  $$SRCPATH/mii/symbolfiltermodel.h
+
 SOURCES +=  tst_testsectiontreeitem.cpp                  \
             $$SRCPATH/mii/abstractmodelinstance.cpp      \
             $$SRCPATH/mii/modelinstance.cpp              \
             $$SRCPATH/mii/datahandler.cpp                \
             $$SRCPATH/mii/datamatrix.cpp                 \
+            $$SRCPATH/mii/reduction.cpp                  \
+            $$SRCPATH/mii/symbolfiltermodel.cpp          \
             $$SRCPATH/mii/filtertreeitem.cpp             \
             $$SRCPATH/mii/labeltreeitem.cpp              \
             $$SRCPATH/mii/symbol.cpp                     \
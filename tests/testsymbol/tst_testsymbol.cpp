@@ -37,6 +37,7 @@ private slots:
     void test_getSet();
     void test_comparison();
     void test_appendDomainLabels();
+    void test_labelLoader();
 };
 
 void TestSymbol::test_default()
@@ -47,8 +48,10 @@ void TestSymbol::test_default()
     QCOMPARE(symbol.name(), QString());
     QCOMPARE(symbol.dimension(), -1);
     QCOMPARE(symbol.type(), Symbol::Unknown);
-    QCOMPARE(symbol.sectionLabels(), SectionLabels());
+    QCOMPARE(symbol.sectionLabels(0), QStringList());
     QCOMPARE(symbol.label(0,0), QString());
+    QCOMPARE(symbol.labelIndex(0,0), 0);
+    QCOMPARE(symbol.labelTable(), nullptr);
     QCOMPARE(symbol.contains(0), false);
     QCOMPARE(symbol.isScalar(), false);
     QVERIFY(symbol.lastOffset()<0);
@@ -95,14 +98,27 @@ void TestSymbol::test_getSet()
     QVERIFY(symbol.contains(value+i));
     QVERIFY(symbol.contains(symbol.lastSection()));
 
-    ++i;
-    QStringList data { "a", "b" };
-    symbol.setLabels(value+i, data);
-    QCOMPARE(symbol.label(value+i, 0), "a");
-    QCOMPARE(symbol.label(value+i, 1), "b");
+    QStringList data { "a", "b", "c" };
+    int uels[] { 3, 1 };
+    symbol.setLabelTable(&data);
+    QCOMPARE(symbol.labelTable(), &data);
+    symbol.setLabelIndices(value+i, uels, 2);
+    QCOMPARE(symbol.labelIndex(value+i, 0), 3);
+    QCOMPARE(symbol.labelIndex(value+i, 1), 1);
+    QCOMPARE(symbol.labelIndex(value+i, 2), 0);
+    QCOMPARE(symbol.labelIndex(value+i+1, 0), 0);
+    QCOMPARE(symbol.label(value+i, 0), "c");
+    QCOMPARE(symbol.label(value+i, 1), "a");
     QCOMPARE(symbol.label(value+i, 2), QString());
-    SectionLabels sectionLabels { { value+i, data } };
-    QCOMPARE(symbol.sectionLabels(), sectionLabels);
+    QCOMPARE(symbol.sectionLabels(value+i), QStringList());
+    Symbol symbol2;
+    symbol2.setEntries(2);
+    symbol2.setDimension(2);
+    symbol2.setFirstSection(0);
+    symbol2.setLabelTable(&data);
+    symbol2.setLabelIndices(1, uels, 2);
+    QCOMPARE(symbol2.sectionLabels(0), QStringList());
+    QCOMPARE(symbol2.sectionLabels(1), QStringList({"c", "a"}));
 
     QSharedPointer<LabelTreeItem> labelTree(new LabelTreeItem);
     symbol.setLabelTree(labelTree);
@@ -135,6 +151,30 @@ void TestSymbol::test_appendDomainLabels()
     QCOMPARE(symbol.domainLabels(), dLabels);
 }
 
+void TestSymbol::test_labelLoader()
+{
+    QStringList labels { "a", "b" };
+    int uels[] { 2 };
+    int calls = 0;
+    Symbol symbol;
+    symbol.setEntries(1);
+    symbol.setDimension(1);
+    symbol.setFirstSection(0);
+    symbol.setLabelTable(&labels);
+    symbol.setLabelLoader([&]{
+        ++calls;
+        symbol.setLabelIndices(0, uels, 1);
+        symbol.setLabelsLoaded(true);
+    });
+    QVERIFY(!symbol.labelsLoaded());
+    QCOMPARE(calls, 0);
+    QCOMPARE(symbol.label(0, 0), "b");
+    QVERIFY(symbol.labelsLoaded());
+    QCOMPARE(symbol.sectionLabels(0), QStringList({"b"}));
+    QCOMPARE(symbol.labelIndex(0, 0), 2);
+    QCOMPARE(calls, 1);
+}
+
 QTEST_APPLESS_MAIN(TestSymbol)
 
 #include "tst_testsymbol.moc"
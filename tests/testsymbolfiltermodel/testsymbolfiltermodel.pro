@@ -0,0 +1,21 @@
+include(../tests.pri)
+
+CONFIG += qt console warn_on depend_includepath testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+INCLUDEPATH += $$SRCPATH/mii \
+               $$TESTSROOT
+
+HEADERS +=  $$TESTSROOT/fixturemodelinstance.h       \
+            $$SRCPATH/mii/symbolfiltermodel.h
+
+SOURCES +=  tst_testsymbolfiltermodel.cpp            \
+            $$SRCPATH/mii/symbolfiltermodel.cpp      \
+            $$SRCPATH/mii/abstractmodelinstance.cpp  \
+            $$SRCPATH/mii/datamatrix.cpp             \
+            $$SRCPATH/mii/symbol.cpp                 \
+            $$SRCPATH/mii/labeltreeitem.cpp          \
+            $$SRCPATH/mii/common.cpp                 \
+            $$SRCPATH/mii/postopttreeitem.cpp
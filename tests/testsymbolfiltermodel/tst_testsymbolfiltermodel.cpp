@@ -0,0 +1,308 @@
+/**
+ * GAMS Model Instance Inspector (MII)
+ *
+ * Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <QtTest>
+#include <QStandardItemModel>
+
+#include "symbolfiltermodel.h"
+#include "fixturemodelinstance.h"
+
+using namespace gams::studio::mii;
+
+class TestSymbolFilterModel : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void test_compile();
+    void test_matchesAllLabels();
+    void test_matchesAnyLabels();
+
+    void test_labelFilter_all();
+    void test_labelFilter_any();
+
+    void test_valueFilter_range();
+    void test_valueFilter_absolute();
+
+    void test_identifierFilter();
+    void test_identifierState();
+
+private:
+    ///
+    /// \brief Source model with the Jacobian of the fixture model instance,
+    ///        where the headers are the section indices.
+    ///
+    QStandardItemModel* sourceModel(AbstractModelInstance &modelInstance);
+
+    QVector<int> sourceColumns(const SymbolFilterModel &model);
+    QVector<int> sourceRows(const SymbolFilterModel &model);
+};
+
+void TestSymbolFilterModel::test_compile()
+{
+    QStringList labels { "a", "b", "C" };
+    auto filter = SymbolFilterModel::compile(LabelCheckStates(), labels);
+    QVERIFY(filter.Checked.isEmpty());
+    QVERIFY(filter.Unchecked.isEmpty());
+
+    LabelCheckStates states { {"A", Qt::Checked}, {"b", Qt::Unchecked},
+                              {"c", Qt::Unchecked}, {"z", Qt::Checked} };
+    filter = SymbolFilterModel::compile(states, labels);
+    QCOMPARE(filter.Checked.size(), 4);
+    QCOMPARE(filter.Unchecked.size(), 4);
+    QVERIFY(!filter.Checked.testBit(0));
+    QVERIFY(filter.Checked.testBit(1));
+    QVERIFY(!filter.Checked.testBit(2));
+    QVERIFY(!filter.Checked.testBit(3));
+    QVERIFY(!filter.Unchecked.testBit(1));
+    QVERIFY(filter.Unchecked.testBit(2));
+    QVERIFY(filter.Unchecked.testBit(3));
+}
+
+void TestSymbolFilterModel::test_matchesAllLabels()
+{
+    FixtureModelInstance modelInstance;
+    auto x = modelInstance.variable(0);
+    auto y = modelInstance.variable(4);
+    auto filter = SymbolFilterModel::compile({ {"a", Qt::Checked}, {"b", Qt::Unchecked} },
+                                             modelInstance.labels());
+    QVERIFY(SymbolFilterModel::matchesAllLabels(filter, x, 0));
+    QVERIFY(!SymbolFilterModel::matchesAllLabels(filter, x, 1));
+    QVERIFY(!SymbolFilterModel::matchesAllLabels(filter, x, 2));
+    QVERIFY(!SymbolFilterModel::matchesAllLabels(filter, x, 3));
+    QVERIFY(SymbolFilterModel::matchesAllLabels(filter, y, 4));
+    QVERIFY(SymbolFilterModel::matchesAllLabels(filter, nullptr, 0));
+    QVERIFY(SymbolFilterModel::matchesAllLabels(SymbolFilterModel::UelFilter(), x, 3));
+}
+
+void TestSymbolFilterModel::test_matchesAnyLabels()
+{
+    FixtureModelInstance modelInstance;
+    auto x = modelInstance.variable(0);
+    auto y = modelInstance.variable(4);
+    auto filter = SymbolFilterModel::compile({ {"a", Qt::Checked}, {"b", Qt::Unchecked} },
+                                             modelInstance.labels());
+    QVERIFY(SymbolFilterModel::matchesAnyLabels(filter, x, 0));
+    QVERIFY(SymbolFilterModel::matchesAnyLabels(filter, x, 1));
+    QVERIFY(SymbolFilterModel::matchesAnyLabels(filter, x, 2));
+    QVERIFY(!SymbolFilterModel::matchesAnyLabels(filter, x, 3));
+    QVERIFY(SymbolFilterModel::matchesAnyLabels(filter, y, 4));
+    QVERIFY(SymbolFilterModel::matchesAnyLabels(filter, nullptr, 0));
+    QVERIFY(!SymbolFilterModel::matchesAnyLabels(SymbolFilterModel::UelFilter(), x, 0));
+}
+
+void TestSymbolFilterModel::test_labelFilter_all()
+{
+    QSharedPointer<AbstractModelInstance> modelInstance(new FixtureModelInstance);
+    QScopedPointer<QStandardItemModel> source(sourceModel(*modelInstance));
+    SymbolFilterModel model(modelInstance);
+    model.setSourceModel(source.get());
+    QCOMPARE(model.rowCount(), 3);
+    QCOMPARE(model.columnCount(), 5);
+
+    LabelFilter filter;
+    filter.Any = false;
+    filter.LabelCheckStates[Qt::Horizontal] = { {"a", Qt::Checked}, {"b", Qt::Unchecked} };
+    filter.LabelCheckStates[Qt::Vertical] = { {"a", Qt::Checked}, {"b", Qt::Unchecked} };
+    model.setLabelFilter(filter);
+    QCOMPARE(sourceColumns(model), QVector<int>({0, 4}));
+    QCOMPARE(sourceRows(model), QVector<int>({0, 2}));
+    QCOMPARE(model.data(model.index(1, 0)), QVariant(6.0));
+    QCOMPARE(model.data(model.index(0, 1)), QVariant(3.0));
+    QCOMPARE(model.headerData(1, Qt::Horizontal), QVariant(4));
+    QVERIFY(!model.mapFromSource(source->index(1, 0)).isValid());
+    QCOMPARE(model.mapFromSource(source->index(2, 4)), model.index(1, 1));
+    QCOMPARE(model.mapSectionFromSource(4, Qt::Horizontal), 1);
+    QCOMPARE(model.mapSectionFromSource(1, Qt::Horizontal), -1);
+    QCOMPARE(model.mapSectionFromSource(2, Qt::Vertical), 1);
+    QCOMPARE(model.mapSectionFromSource(5, Qt::Vertical), -1);
+    QCOMPARE(model.mapSectionFromSource(-1, Qt::Vertical), -1);
+}
+
+void TestSymbolFilterModel::test_labelFilter_any()
+{
+    QSharedPointer<AbstractModelInstance> modelInstance(new FixtureModelInstance);
+    QScopedPointer<QStandardItemModel> source(sourceModel(*modelInstance));
+    SymbolFilterModel model(modelInstance);
+    model.setSourceModel(source.get());
+
+    LabelFilter filter;
+    filter.Any = true;
+    filter.LabelCheckStates[Qt::Horizontal] = { {"a", Qt::Checked}, {"b", Qt::Unchecked} };
+    filter.LabelCheckStates[Qt::Vertical] = { {"a", Qt::Unchecked}, {"b", Qt::Checked} };
+    model.setLabelFilter(filter);
+    QCOMPARE(sourceColumns(model), QVector<int>({0, 1, 2, 4}));
+    QCOMPARE(sourceRows(model), QVector<int>({1, 2}));
+    QCOMPARE(model.data(model.index(0, 2)), QVariant(4.0));
+    QCOMPARE(model.data(model.index(1, 3)), QVariant(-7.0));
+}
+
+void TestSymbolFilterModel::test_valueFilter_range()
+{
+    QSharedPointer<AbstractModelInstance> modelInstance(new FixtureModelInstance);
+    QScopedPointer<QStandardItemModel> source(sourceModel(*modelInstance));
+    SymbolFilterModel model(modelInstance);
+    model.setSourceModel(source.get());
+    QSignalSpy dataChanged(&model, &QAbstractItemModel::dataChanged);
+
+    ValueFilter filter;
+    filter.MinValue = -2.0;
+    filter.MaxValue = 4.0;
+    model.setValueFilter(filter);
+    QCOMPARE(dataChanged.count(), 1);
+    // the value filter only hides cells, i.e. all sections stay visible
+    QCOMPARE(model.rowCount(), 3);
+    QCOMPARE(model.columnCount(), 5);
+    QCOMPARE(model.data(model.index(0, 0)), QVariant(1.0));
+    QCOMPARE(model.data(model.index(0, 1)), QVariant(-2.0));
+    QCOMPARE(model.data(model.index(1, 2)), QVariant(4.0));
+    QCOMPARE(model.data(model.index(1, 3)), QVariant());
+    QCOMPARE(model.data(model.index(2, 0)), QVariant());
+    QCOMPARE(model.data(model.index(2, 1)), QVariant());
+
+    filter.ExcludeRange = true;
+    model.setValueFilter(filter);
+    QCOMPARE(model.data(model.index(0, 0)), QVariant());
+    QCOMPARE(model.data(model.index(1, 2)), QVariant());
+    QCOMPARE(model.data(model.index(1, 3)), QVariant(-5.0));
+    QCOMPARE(model.data(model.index(2, 0)), QVariant(6.0));
+    QCOMPARE(model.data(model.index(2, 1)), QVariant());
+}
+
+void TestSymbolFilterModel::test_valueFilter_absolute()
+{
+    QSharedPointer<AbstractModelInstance> modelInstance(new FixtureModelInstance);
+    QScopedPointer<QStandardItemModel> source(sourceModel(*modelInstance));
+    SymbolFilterModel model(modelInstance);
+    model.setSourceModel(source.get());
+
+    ValueFilter filter;
+    filter.UseAbsoluteValues = true;
+    filter.MinValue = 2.0;
+    filter.MaxValue = 5.0;
+    model.setValueFilter(filter);
+    QCOMPARE(model.data(model.index(0, 0)), QVariant());
+    QCOMPARE(model.data(model.index(0, 1)), QVariant(2.0));
+    QCOMPARE(model.data(model.index(0, 4)), QVariant(3.0));
+    QCOMPARE(model.data(model.index(1, 3)), QVariant(5.0));
+    QCOMPARE(model.data(model.index(2, 4)), QVariant());
+    auto value = model.data(model.index(1, 3), ViewHelper::NumericDataRole).value<NumericValue>();
+    QVERIFY(value.Valid);
+    QCOMPARE(value.Value, 5.0);
+}
+
+void TestSymbolFilterModel::test_identifierFilter()
+{
+    QSharedPointer<AbstractModelInstance> modelInstance(new FixtureModelInstance);
+    QScopedPointer<QStandardItemModel> source(sourceModel(*modelInstance));
+    SymbolFilterModel model(modelInstance);
+    model.setSourceModel(source.get());
+
+    IdentifierFilter filter;
+    for (auto symbol : modelInstance->variables()) {
+        IdentifierState state;
+        state.SymbolIndex = symbol->firstSection();
+        state.Text = symbol->name();
+        state.Checked = symbol->name() == "x" ? Qt::Unchecked : Qt::Checked;
+        filter[Qt::Horizontal][state.SymbolIndex] = state;
+    }
+    for (auto symbol : modelInstance->equations()) {
+        IdentifierState state;
+        state.SymbolIndex = symbol->firstSection();
+        state.Text = symbol->name();
+        state.Checked = Qt::Checked;
+        filter[Qt::Vertical][state.SymbolIndex] = state;
+    }
+    model.setIdentifierFilter(filter);
+    QCOMPARE(sourceColumns(model), QVector<int>({4}));
+    QCOMPARE(sourceRows(model), QVector<int>({0, 1, 2}));
+    QCOMPARE(model.data(model.index(2, 0)), QVariant(-7.0));
+
+    filter[Qt::Horizontal][0].Checked = Qt::Checked;
+    filter[Qt::Vertical][0].Checked = Qt::Unchecked;
+    model.setIdentifierFilter(filter);
+    QCOMPARE(sourceColumns(model), QVector<int>({0, 1, 2, 3, 4}));
+    QCOMPARE(sourceRows(model), QVector<int>({2}));
+}
+
+void TestSymbolFilterModel::test_identifierState()
+{
+    QSharedPointer<AbstractModelInstance> modelInstance(new FixtureModelInstance);
+    QScopedPointer<QStandardItemModel> source(sourceModel(*modelInstance));
+    SymbolFilterModel model(modelInstance);
+    model.setSourceModel(source.get());
+
+    IdentifierState state;
+    state.SymbolIndex = 0;
+    state.Text = "x";
+    state.Checked = Qt::PartiallyChecked;
+    state.CheckStates = { {0, Qt::Checked}, {1, Qt::Unchecked},
+                          {2, Qt::Unchecked}, {3, Qt::Checked} };
+    model.setIdentifierState(state, Qt::Horizontal);
+    QCOMPARE(sourceColumns(model), QVector<int>({0, 3, 4}));
+    QCOMPARE(model.identifierState(0, Qt::Horizontal).CheckStates, state.CheckStates);
+
+    model.clearIdentifierStates();
+    model.setLabelFilter(LabelFilter());
+    QCOMPARE(sourceColumns(model), QVector<int>({0, 1, 2, 3, 4}));
+}
+
+QStandardItemModel* TestSymbolFilterModel::sourceModel(AbstractModelInstance &modelInstance)
+{
+    QScopedPointer<DataMatrix> matrix(modelInstance.jacobianData());
+    auto model = new QStandardItemModel(matrix->rowCount(), matrix->columnCount());
+    for (int r=0; r<matrix->rowCount(); ++r) {
+        model->setHeaderData(r, Qt::Vertical, r);
+        auto row = matrix->row(r);
+        for (int e=0; e<row.entries(); ++e) {
+            auto item = new QStandardItem;
+            item->setData(row.inputData()[e], Qt::DisplayRole);
+            item->setData(QVariant::fromValue(NumericValue(row.inputData()[e])),
+                          ViewHelper::NumericDataRole);
+            model->setItem(r, row.colIdx()[e], item);
+        }
+    }
+    for (int c=0; c<matrix->columnCount(); ++c) {
+        model->setHeaderData(c, Qt::Horizontal, c);
+    }
+    return model;
+}
+
+QVector<int> TestSymbolFilterModel::sourceColumns(const SymbolFilterModel &model)
+{
+    QVector<int> columns;
+    for (int c=0; c<model.columnCount(); ++c) {
+        columns.append(model.mapToSource(model.index(0, c)).column());
+    }
+    return columns;
+}
+
+QVector<int> TestSymbolFilterModel::sourceRows(const SymbolFilterModel &model)
+{
+    QVector<int> rows;
+    for (int r=0; r<model.rowCount(); ++r) {
+        rows.append(model.mapToSource(model.index(r, 0)).row());
+    }
+    return rows;
+}
+
+QTEST_APPLESS_MAIN(TestSymbolFilterModel)
+
+#include "tst_testsymbolfiltermodel.moc"